@@ -0,0 +1,130 @@
+#ifndef ACCUMULATORS_HPP
+#define ACCUMULATORS_HPP
+
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include <Eigen/Dense>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Single-pass, mergeable accumulator of count, mean, variance, min and max
+ * 
+ * Values are folded in with Welford's update, which avoids the cancellation of
+ * the naive sum-of-squares formula. Two accumulators built over disjoint parts
+ * of the data can be merged (Chan et al.), so partial results computed per
+ * batch, chunk or thread combine into the statistics of the whole data.
+ */
+class RunningStats {
+public:
+    RunningStats() = default;
+
+    /// Adds one value
+    void push(double x) {
+        ++n;
+        double delta = x - mu;
+        mu += delta / static_cast<double>(n);
+        sq += delta * (x - mu);
+        lo = std::min(lo, x);
+        hi = std::max(hi, x);
+    }
+
+    /// Combines the statistics of another accumulator into this one
+    void merge(const RunningStats& other) {
+        if (other.n == 0) return;
+        if (n == 0) {
+            *this = other;
+            return;
+        }
+        double total = static_cast<double>(n + other.n);
+        double delta = other.mu - mu;
+        mu += delta * static_cast<double>(other.n) / total;
+        sq += other.sq + delta * delta * static_cast<double>(n) * static_cast<double>(other.n) / total;
+        n += other.n;
+        lo = std::min(lo, other.lo);
+        hi = std::max(hi, other.hi);
+    }
+
+    size_t count() const { return n; }
+    double mean() const { return n ? mu : std::numeric_limits<double>::quiet_NaN(); }
+    /// Sum of squared deviations from the mean
+    double m2() const { return sq; }
+    /// Population variance (divides by n), as StatisticalAnalyzer::variance
+    double variance() const { return n ? sq / static_cast<double>(n) : std::numeric_limits<double>::quiet_NaN(); }
+    /// Sample variance (divides by n - 1)
+    double sampleVariance() const {
+        return n > 1 ? sq / static_cast<double>(n - 1) : std::numeric_limits<double>::quiet_NaN();
+    }
+    double standardDeviation() const { return std::sqrt(variance()); }
+    double min() const { return n ? lo : std::numeric_limits<double>::quiet_NaN(); }
+    double max() const { return n ? hi : std::numeric_limits<double>::quiet_NaN(); }
+
+private:
+    size_t n = 0;
+    double mu = 0.0;
+    double sq = 0.0;
+    double lo = std::numeric_limits<double>::infinity();
+    double hi = -std::numeric_limits<double>::infinity();
+};
+
+/**
+ * @brief Single-pass, mergeable accumulator of means and co-moments of k variables
+ * 
+ * Keeps the count, the mean vector and the matrix of centered co-moments
+ * C = sum (x - mean)(x - mean)^T, from which covariance and correlation
+ * matrices follow. Observations can be pushed one at a time or as a block of
+ * rows; blocks and other accumulators are combined with the pairwise update
+ * C = Ca + Cb + (mb - ma)(mb - ma)^T * na * nb / n.
+ * 
+ * C is symmetric, so only its upper triangle is accumulated: every update is
+ * a symmetric rank-1 or rank-k update (SYRK), which halves the arithmetic of
+ * a full matrix product.
+ */
+class CoMoments {
+public:
+    explicit CoMoments(size_t dims = 0);
+
+    /// Adds one observation (a vector of dims values)
+    void push(const Eigen::Ref<const Eigen::VectorXd>& row);
+
+    /// Adds a block of observations, one per row (rows x dims)
+    void pushBlock(const Eigen::Ref<const Eigen::MatrixXd>& block);
+
+    /// Combines another accumulator over the same variables into this one
+    void merge(const CoMoments& other);
+
+    size_t dims() const { return static_cast<size_t>(mu.size()); }
+    size_t count() const { return n; }
+    const Eigen::VectorXd& mean() const { return mu; }
+    /// Full (symmetric) matrix of centered co-moments
+    Eigen::MatrixXd comoments() const;
+
+    /**
+     * @brief Accumulator restricted to some of the variables
+     * @param variables Indices of the variables to keep, in the order wanted
+     * @throws std::out_of_range if an index is not below dims()
+     */
+    CoMoments select(const std::vector<size_t>& variables) const;
+
+    /// Sample covariance matrix (divides by n - 1)
+    Eigen::MatrixXd covariance() const;
+
+    /**
+     * @brief Pearson correlation matrix
+     * @param upperTriangleOnly If true, only the upper triangle (diagonal
+     *        included) is filled and the strict lower triangle is left at zero
+     */
+    Eigen::MatrixXd correlation(bool upperTriangleOnly = false) const;
+
+private:
+    size_t n = 0;
+    Eigen::VectorXd mu;
+    Eigen::MatrixXd c;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // ACCUMULATORS_HPP
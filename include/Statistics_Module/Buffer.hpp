@@ -0,0 +1,125 @@
+#ifndef BUFFER_HPP
+#define BUFFER_HPP
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Contiguous array that either owns its elements or borrows them
+ *
+ * An owned buffer is a plain std::vector. A borrowed buffer points into memory
+ * owned by someone else (a memory-mapped snapshot, a NumPy array, ...), kept
+ * alive through a type-erased shared_ptr for as long as the buffer exists.
+ * Reads never copy; the first mutating call on a borrowed buffer copies the
+ * elements into an owned vector (copy-on-write), so columns loaded without
+ * deserialization can still be appended to.
+ *
+ * @tparam T Trivially copyable element type
+ */
+template <typename T>
+class Buffer {
+public:
+    Buffer() = default;
+
+    /**
+     * @brief Borrows size elements starting at data
+     * @param owner Keeps the memory alive; must not be null
+     */
+    Buffer(const T* data, size_t size, std::shared_ptr<const void> owner)
+        : data_(data), size_(size), owner_(std::move(owner)) {}
+
+    Buffer(std::vector<T> values) : owned_(std::move(values)) { sync(); }
+
+    Buffer(const Buffer& other) : owned_(other.owned_), data_(other.data_), size_(other.size_), owner_(other.owner_) {
+        if (!owner_) sync();
+    }
+
+    Buffer(Buffer&& other) noexcept
+        : owned_(std::move(other.owned_)), data_(other.data_), size_(other.size_), owner_(std::move(other.owner_)) {
+        if (!owner_) sync();
+        other.owner_.reset();
+        other.sync();
+    }
+
+    Buffer& operator=(Buffer other) noexcept {
+        owned_.swap(other.owned_);
+        owner_.swap(other.owner_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        if (!owner_) sync();
+        return *this;
+    }
+
+    /// True while the elements live in borrowed memory
+    bool borrowed() const { return owner_ != nullptr; }
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+    const T& operator[](size_t i) const { return data_[i]; }
+
+    /**
+     * @brief Owner keeping the current elements alive and unchanged
+     *
+     * Owned elements are first moved to shared storage that the buffer then
+     * borrows, so pointers handed out with the returned owner stay valid: later
+     * writes to the buffer copy the elements instead (copy-on-write).
+     */
+    std::shared_ptr<const void> share() {
+        if (!owner_) {
+            auto shared = std::make_shared<const std::vector<T>>(std::move(owned_));
+            owned_ = std::vector<T>();
+            data_ = shared->data();
+            size_ = shared->size();
+            owner_ = shared;
+        }
+        return owner_;
+    }
+
+    /// Owned capacity in elements (0 for borrowed memory, which is not on the heap)
+    size_t capacity() const { return owner_ ? 0 : owned_.capacity(); }
+
+    T& operator[](size_t i) { own(); return owned_[i]; }
+    T& back() { own(); return owned_.back(); }
+
+    void push_back(const T& value) { own(); owned_.push_back(value); sync(); }
+
+    template <typename It>
+    void append(It first, It last) { own(); owned_.insert(owned_.end(), first, last); sync(); }
+
+    void reserve(size_t n) { own(); owned_.reserve(n); sync(); }
+    void resize(size_t n) { own(); owned_.resize(n); sync(); }
+    void assign(size_t n, const T& value) { own(); owned_.assign(n, value); sync(); }
+
+    /// Drops the elements (and any borrowed memory), keeping the owned capacity
+    void clear() { owner_.reset(); owned_.clear(); sync(); }
+
+private:
+    void own() {
+        if (owner_) {
+            owned_.assign(data_, data_ + size_);
+            owner_.reset();
+            sync();
+        }
+    }
+
+    void sync() {
+        data_ = owned_.data();
+        size_ = owned_.size();
+    }
+
+    std::vector<T> owned_;
+    const T* data_ = nullptr;
+    size_t size_ = 0;
+    std::shared_ptr<const void> owner_;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // BUFFER_HPP
@@ -0,0 +1,267 @@
+#ifndef COLUMN_HPP
+#define COLUMN_HPP
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+
+#include "Utils.hpp"
+#include "StringPool.hpp"
+#include "Buffer.hpp"
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Physical storage type of a Column
+ *
+ * - Empty:  no non-null value has been appended yet
+ * - Int:    contiguous int32_t buffer
+ * - Double: contiguous double buffer
+ * - String: dictionary-encoded strings (uint32_t codes into an interned StringPool)
+ * - Mixed:  fallback for columns mixing numbers and strings, stored as DataValue
+ */
+enum class ColumnType { Empty, Int, Double, String, Mixed };
+
+/**
+ * @brief Non-owning, zero-copy view over the typed buffer of a Column
+ *
+ * The view covers every row of the column, null rows included. Null rows usually
+ * hold a placeholder (0 for ints and codes, NaN for doubles; rows masked out by
+ * Column::masked keep their value) and are marked by a cleared bit in the
+ * validity bitmap, so callers that care about missing values must check
+ * isValid() or nullCount().
+ *
+ * The view is invalidated by any operation that appends to the owning Dataset.
+ *
+ * @tparam T Element type (int32_t, double, or uint32_t for string codes)
+ */
+template <typename T>
+class ColumnView {
+public:
+    ColumnView() = default;
+    ColumnView(const T* data, size_t size, const uint64_t* validity, size_t nullCount)
+        : data_(data), size_(size), validity_(validity), nullCount_(nullCount) {}
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+    /// Number of null rows covered by the view
+    size_t nullCount() const { return nullCount_; }
+
+    /// Validity bitmap, one bit per row (bit set = value present)
+    const uint64_t* validity() const { return validity_; }
+
+    bool isValid(size_t i) const {
+        return (validity_[i >> 6] >> (i & 63)) & 1u;
+    }
+
+private:
+    const T* data_ = nullptr;
+    size_t size_ = 0;
+    const uint64_t* validity_ = nullptr;
+    size_t nullCount_ = 0;
+};
+
+/**
+ * @brief A single column of a Dataset stored as one contiguous typed array
+ *
+ * The column picks its physical type from the first non-null value appended
+ * and adapts when later values do not fit:
+ * - an int column receiving a double is widened to Double
+ * - a double column receiving an int stores it as a double
+ * - a numeric column receiving a string (or vice versa) falls back to Mixed
+ *
+ * Missing values are tracked in a separate validity bitmap rather than inside
+ * the values, so numeric buffers stay dense and can be handed out as ColumnView.
+ * Strings are dictionary-encoded: each distinct value is interned once in the
+ * column's StringPool and rows hold a uint32_t code into it, so comparing, counting
+ * and grouping string rows only touches integers.
+ */
+class Column {
+public:
+    Column() = default;
+
+    ColumnType type() const { return type_; }
+    size_t size() const { return size_; }
+    size_t nullCount() const { return nullCount_; }
+    bool isValid(size_t row) const {
+        return (validity_[row >> 6] >> (row & 63)) & 1u;
+    }
+
+    /// True if the column holds only numbers (or only nulls)
+    bool isNumeric() const {
+        return type_ == ColumnType::Empty || type_ == ColumnType::Int || type_ == ColumnType::Double;
+    }
+
+    /// Reserves room for rows values; an Empty column applies it once its type is known
+    void reserve(size_t rows);
+
+    /// Removes all rows and resets the type, keeping the allocated capacity
+    void clear();
+
+    /**
+     * @brief Appends a value (or a null) at the end of the column
+     * @param value Value to append, std::nullopt for a missing value
+     */
+    void append(const OptionalDataValue& value);
+    void appendNull();
+
+    /// Typed appends used by bulk loaders, skipping the DataValue variant
+    void appendInt(int32_t value);
+    void appendDouble(double value);
+    void appendString(std::string_view value);
+
+    /**
+     * @brief Appends all rows of another column
+     *
+     * Same-type columns are concatenated buffer to buffer (string codes are
+     * remapped to this column's dictionary); an int column followed by a
+     * double column is widened first. Other combinations go value by value.
+     */
+    void append(const Column& other);
+
+    /// Same as append(const Column&), but an empty column takes other's buffers over instead of copying them
+    void append(Column&& other);
+
+    /**
+     * @brief Appends count values from an array in one pass
+     *
+     * Numbers copied into a column of the same type (or an Empty one, or ints
+     * into a Double column) are copied as a block and the validity bitmap is
+     * appended word by word, so the cost is a memcpy rather than one append
+     * per value. Other combinations fall back to append() value by value.
+     *
+     * @tparam T int32_t, double or std::string
+     * @param values count values; entries of null rows are ignored
+     * @param validity (count + 63) / 64 words, bit i set if row i is present,
+     *        or nullptr if no row is null
+     */
+    template <typename T>
+    void appendValues(const T* values, size_t count, const uint64_t* validity = nullptr);
+
+    /**
+     * @brief Builds a column over existing buffers without copying them
+     *
+     * The buffers may borrow memory (e.g. a memory-mapped snapshot); they are
+     * copied only if the column is modified later.
+     *
+     * @tparam T int32_t for an Int column, double for a Double column,
+     *           uint32_t for the codes of a String column
+     * @param values One element per row (null rows hold a placeholder)
+     * @param validity (rows + 63) / 64 words with the bits past the last row
+     *        cleared, or empty if no row is null
+     * @param nullCount Number of cleared bits in validity
+     * @param dictionary Strings of the codes (String columns only)
+     * @throws std::invalid_argument if the validity size does not match
+     */
+    template <typename T>
+    static Column fromBuffers(Buffer<T> values, Buffer<uint64_t> validity, size_t nullCount,
+                              StringPool dictionary = StringPool());
+
+    /**
+     * @brief Copy of the column restricted to selected rows, sharing its values
+     *
+     * Rows whose bit is clear in selection become null. The typed values are
+     * borrowed from this column instead of being copied, so only the validity
+     * bitmap (and the string dictionary) is new; as a consequence, the null
+     * rows of the result may hold a real value instead of NaN.
+     *
+     * @param selection (size() + 63) / 64 words with the bits past size() cleared
+     * @param owner Keeps the buffers of this column alive and unchanged for as
+     *        long as the result exists (see shareValues)
+     */
+    Column masked(const uint64_t* selection, std::shared_ptr<const void> owner) const;
+
+    /**
+     * @brief Returns the value stored at a given row
+     * @param row Row index
+     * @return The value, or std::nullopt if the row is null
+     * @throws std::out_of_range if row >= size()
+     */
+    OptionalDataValue at(size_t row) const;
+
+    /**
+     * @brief Returns a zero-copy view over the typed buffer
+     * @tparam T int32_t for Int columns, double for Double columns,
+     *           uint32_t for the codes of String columns
+     * @throws std::runtime_error if T does not match the physical type
+     */
+    template <typename T>
+    ColumnView<T> view() const;
+
+    /**
+     * @brief Keeps the typed buffer (and validity bitmap) alive beyond the column
+     *
+     * Views taken after this call point into shared memory that stays valid and
+     * unchanged while the returned owner lives, even if the column is appended
+     * to or destroyed: the column copies the buffers on its next write.
+     * Buffers borrowed from a snapshot are shared as they are.
+     */
+    std::shared_ptr<const void> shareValues();
+
+    /// Dictionary of a String column, indexed by code
+    const StringPool& dictionary() const { return dictionary_; }
+
+    /**
+     * @brief Code of a string in this column's dictionary
+     *
+     * Rows of a String column equal to value are exactly the valid rows whose
+     * code is the returned one, so equality tests reduce to integer compares.
+     *
+     * @return The code, or StringPool::npos if no row holds value
+     */
+    uint32_t codeOf(std::string_view value) const { return dictionary_.find(value); }
+
+    /// Approximate heap memory used by the column's buffers, in bytes
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Copies the non-null values of the column converted to T
+     *
+     * Follows the semantics of Utils::extractColumn: nulls are skipped,
+     * int <-> double conversions are applied, and values that cannot be
+     * represented as T are skipped.
+     *
+     * @tparam T int, double or std::string
+     * @return std::vector<T> with the extracted values (possibly empty)
+     */
+    template <typename T>
+    std::vector<T> values() const;
+
+    /**
+     * @brief Copies the column into a row-aligned vector of doubles
+     * @return One double per row; NaN where the row is null or not numeric
+     */
+    std::vector<double> asDoubles() const;
+
+private:
+    void pushValidity(bool valid);
+    void appendValidity(const uint64_t* bits, size_t count);
+    void setType(ColumnType type, size_t rows);
+    void promoteToDouble();
+    void promoteToMixed();
+    uint32_t encode(std::string_view value);
+
+    ColumnType type_ = ColumnType::Empty;
+    size_t size_ = 0;
+    size_t nullCount_ = 0;
+    size_t capacity_ = 0;
+    Buffer<uint64_t> validity_;
+
+    Buffer<int32_t> ints_;
+    Buffer<double> doubles_;
+    Buffer<uint32_t> codes_;
+    StringPool dictionary_;
+    std::vector<DataValue> mixed_;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // COLUMN_HPP
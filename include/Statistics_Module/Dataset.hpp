@@ -5,13 +5,29 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <functional>
 
 #include <optional>
 #include <variant>
 #include "Utils.hpp"
+#include "Column.hpp"
+#include "Selection.hpp"
+#include "../Utilities.hpp"
 
 namespace ScientificToolbox::Statistics {
 
+/**
+ * @brief Schema entry of a binary snapshot, read from its header only
+ */
+struct SnapshotColumn {
+    std::string name;
+    ColumnType type = ColumnType::Empty;
+    size_t count = 0;       ///< Number of non-null rows
+    size_t nullCount = 0;
+    double min = 0.0;       ///< Smallest numeric value (NaN if the column has none)
+    double max = 0.0;       ///< Largest numeric value (NaN if the column has none)
+};
+
 /**
  * @brief A class representing a dataset for statistical analysis
  * 
@@ -21,19 +37,20 @@ namespace ScientificToolbox::Statistics {
  * and missing values.
  * 
  * @details The class implements:
- * - Forward iterator support for row-wise traversal
+ * - Iterator support for row-wise traversal
  * - Column-based data access
+ * - Zero-copy column views over typed buffers
  * - Dynamic row addition
  * - Column type checking
  * 
- * The internal structure uses a vector of unordered maps, where:
- * - Each vector element represents a row
- * - Each unordered_map represents columns as key-value pairs
- * - Keys are column names (strings)
- * - Values are OptionalDataValue objects that can hold different types
+ * The internal structure is columnar:
+ * - Each column is a Column object holding one contiguous typed array
+ *   (int32_t, double, or dictionary-encoded strings)
+ * - Missing values are tracked in a per-column validity bitmap
+ * - Column names map to column indices through a single lookup table
  * 
- * Iterator implementation provides standard forward iterator capabilities
- * conforming to C++ iterator requirements.
+ * Rows are materialized on demand as unordered maps when iterating, so
+ * row-wise traversal keeps working on top of the columnar layout.
  * 
  * @note The class is part of the ScientificToolbox::Statistics namespace
  * and is designed for scientific computing applications.
@@ -42,46 +59,56 @@ namespace ScientificToolbox::Statistics {
  * @code
  * Dataset ds;
  * ds.addRow({{"col1", 1}, {"col2", "value"}});
+ * ds.addRows({"col1", "col2"}, {{2, "other"}, {3, std::nullopt}});
  * auto numericData = ds.getColumn<double>("col1");
+ * auto view = ds.getColumnView<int32_t>("col1");   // no copy
  * @endcode
  */
 class Dataset {
 public:
+    using Row = std::unordered_map<std::string, OptionalDataValue>;
+
+    /// Column-oriented batch of rows: one named column per column of the dataset
+    using ColumnBatch = std::vector<std::pair<std::string, Column>>;
+
     class Iterator {
 
         private:
-            std::vector<std::unordered_map<std::string, OptionalDataValue>>::iterator it;
+            const Dataset* dataset;
+            size_t index;
+            mutable Row current;
         public:
-            using iterator_category = std::forward_iterator_tag;
-            using value_type = std::unordered_map<std::string, OptionalDataValue>;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Row;
             using difference_type = std::ptrdiff_t;
-            using pointer = value_type*;
-            using reference = value_type&;
+            using pointer = const value_type*;
+            using reference = const value_type&;
 
-            Iterator(std::vector<std::unordered_map<std::string, OptionalDataValue>>::iterator iter): it(iter) {}
+            Iterator(const Dataset* ds, size_t idx): dataset(ds), index(idx) {}
 
-            reference operator*()  {
-                return *it;
+            reference operator*() const {
+                current = dataset->row(index);
+                return current;
             }
-            pointer operator->() {
-                return &(*it);
+            pointer operator->() const {
+                return &(**this);
             }
             Iterator& operator++() {
-                ++it;
+                ++index;
                 return *this;
             }
             Iterator operator++(int) {
                 Iterator tmp = *this;
-                ++it;
+                ++index;
                 return tmp;
             }
 
             bool operator==(const Iterator& other) const {
-                return it == other.it;
+                return dataset == other.dataset && index == other.index;
             }
 
             bool operator!=(const Iterator& other) const {
-                return it != other.it;
+                return !(*this == other);
             }
 
 
@@ -90,23 +117,209 @@ public:
     Dataset() = default;
     explicit Dataset(const std::vector<std::unordered_map<std::string, OptionalDataValue>>& data);
 
+    /**
+     * @brief Loads a CSV file straight into the columnar storage
+     * @param filename Path of the CSV file
+     * @param threads Number of parsing threads
+     * @param options Schema inference settings, per-column type overrides,
+     *        column projection and row predicate
+     * @return Dataset with one column per header field
+     * @throws std::runtime_error if the file cannot be opened, has no header
+     *         or has duplicate column names
+     * 
+     * Uses the memory-mapped Importer mode: cells are parsed in place and
+     * appended to the typed column buffers without building row maps.
+     * With threads > 1 the file is parsed in that many byte ranges in
+     * parallel and the partial datasets are concatenated in file order.
+     * Column types are inferred once from the first options.sampleRows records,
+     * so every range parses a column with the same typed parser.
+     * With options.columns only those columns are created (in that order) and
+     * the other fields are skipped without being parsed; options.predicate
+     * drops records before any of their cells is appended.
+     * @throws std::invalid_argument if options.types or options.columns names
+     *         an unknown column
+     */
+    static Dataset fromCSV(const std::string& filename, unsigned threads = 1,
+                           const ImportOptions& options = ImportOptions());
+
+    /**
+     * @brief Streams a CSV file in batches of rows without loading it whole
+     * @param filename Path of the CSV file
+     * @param batchRows Maximum number of rows per batch
+     * @param onBatch Called with each batch in file order; the batch is reused
+     *        after the call returns, so it must not be kept
+     * @throws std::runtime_error if the file cannot be opened or has no header
+     * 
+     * Memory use is bounded by one batch, regardless of the file size.
+     */
+    static void streamCSV(const std::string& filename, size_t batchRows,
+                          const std::function<void(const Dataset&)>& onBatch);
+
+    /**
+     * @brief Writes the dataset to a binary columnar snapshot
+     * @param filename Path of the file to create (overwritten if it exists)
+     * @throws std::runtime_error if the file cannot be written
+     * 
+     * The snapshot stores, for every column, its typed buffer, its validity
+     * bitmap and (for strings) its dictionary as 64-byte aligned blocks, after
+     * a header with the schema and per-column count/min/max. The file uses the
+     * host byte order and is meant to be reread on the same kind of machine.
+     */
+    void save(const std::string& filename) const;
+
+    /**
+     * @brief Opens a snapshot written by save() without deserializing it
+     * @param filename Path of the snapshot
+     * @return Dataset whose Int, Double and String columns borrow the
+     *         memory-mapped blocks; pages are read lazily on first access
+     * @throws std::runtime_error if the file is not a valid snapshot
+     * 
+     * Only string dictionaries (and Mixed columns) are copied. A borrowed column
+     * is copied into owned memory the first time the dataset is modified.
+     * The header and block bounds are validated, the buffer contents are not,
+     * so snapshots should come from a trusted source.
+     */
+    static Dataset fromSnapshot(const std::string& filename);
+
+    /**
+     * @brief Reads the schema and per-column statistics from a snapshot header
+     * @throws std::runtime_error if the file is not a valid snapshot
+     */
+    static std::vector<SnapshotColumn> snapshotSchema(const std::string& filename);
+
+    /// True if the file starts with the snapshot signature
+    static bool isSnapshot(const std::string& filename);
+
+    /**
+     * @brief Loads a snapshot or a CSV file, detected from the file contents
+     * @param threads Number of CSV parsing threads (ignored for snapshots)
+     * @param options CSV import options (ignored for snapshots)
+     */
+    static Dataset load(const std::string& filename, unsigned threads = 1,
+                        const ImportOptions& options = ImportOptions());
+
     //methods
 
-    Iterator begin() {
-        return Iterator(data.begin());
+    Iterator begin() const {
+        return Iterator(this, 0);
     }
-    Iterator end() {
-        return Iterator(data.end());
+    Iterator end() const {
+        return Iterator(this, rows);
     }
 
     template <typename T>
     std::vector<T> getColumn(const std::string& columnName) const;
+
+    /**
+     * @brief Returns a zero-copy view over the typed buffer of a column
+     * @tparam T int32_t for integer columns, double for floating point columns,
+     *           uint32_t for the dictionary codes of string columns
+     * @param columnName Name of the column
+     * @throws std::runtime_error if the column does not exist or T does not
+     *         match its storage type
+     */
+    template <typename T>
+    ColumnView<T> getColumnView(const std::string& columnName) const {
+        return column(columnName).view<T>();
+    }
+
+    /**
+     * @brief Returns the Column object backing a column name
+     * @throws std::runtime_error if the dataset is empty or the column does not exist
+     */
+    const Column& column(const std::string& columnName) const;
+
+    /**
+     * @brief Shares the buffers of a column so that views of it outlive changes
+     * @return Owner keeping the memory of getColumnView(columnName) (taken after
+     *         this call) valid and unchanged, see Column::shareValues
+     * @throws std::runtime_error if the column does not exist
+     */
+    std::shared_ptr<const void> shareColumn(const std::string& columnName);
+
+    /**
+     * @brief Materializes a single row as a map from column name to value
+     * @throws std::out_of_range if i >= size()
+     */
+    Row row(size_t i) const;
+
     std::vector<std::string> getColumnNames() const;
-    size_t size() const {return data.size();}
-    bool empty() const {return data.empty();}
+    size_t size() const {return rows;}
+    bool empty() const {return rows == 0;}
+
+    /// Approximate heap memory used by the column buffers, in bytes
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Identifier of the contents of the dataset, up to appended rows
+     *
+     * addRow, addRows, append, appendBatch and addColumn only add rows or columns and keep the
+     * revision; copying, moving or assigning a dataset gives the target a new
+     * one. Two observations with the same revision therefore see the same
+     * values in their common rows, which lets caches fold in appended rows only.
+     */
+    uint64_t revision() const { return revisionId.id; }
 
     void addRow(const std::unordered_map<std::string, OptionalDataValue>& row);
 
+    /**
+     * @brief Appends rows given as values in a fixed column order
+     * @param columnNames Column of each position in a row; must name every
+     *        column exactly once (it defines the columns of an empty dataset)
+     * @param values Rows with one value per column name
+     * @throws std::runtime_error if columnNames does not match the columns or
+     *         a row does not have columnNames.size() values; nothing is appended then
+     * 
+     * The schema is checked once for the whole batch instead of once per row,
+     * capacity is reserved once, and rows hold plain vectors instead of maps.
+     */
+    void addRows(const std::vector<std::string>& columnNames,
+                 const std::vector<std::vector<OptionalDataValue>>& values);
+
+    /**
+     * @brief Appends a column-oriented batch of rows, moving its buffers in
+     * @param batch One column per column of the dataset, in any order, all
+     *        with the same number of rows (it defines the columns of an empty dataset)
+     * @throws std::runtime_error if a column is missing, unknown or repeated,
+     *         or the columns differ in length; nothing is appended then
+     * 
+     * Columns are typically built with Column::fromBuffers or
+     * Column::appendValues from arrays and validity bitmaps. An empty dataset
+     * takes their buffers over; otherwise each one is concatenated buffer to
+     * buffer, so appending a batch costs about one memcpy per column.
+     */
+    void appendBatch(ColumnBatch batch);
+
+    /**
+     * @brief Adds a column built elsewhere (e.g. by an aggregation) without copying it row by row
+     * @param name Name of the new column
+     * @param column Column with size() rows (any number of rows if the dataset has no columns yet)
+     * @throws std::runtime_error if the name already exists or the number of rows differs
+     */
+    void addColumn(const std::string& name, Column column);
+
+    /**
+     * @brief Restricts a dataset to selected rows without copying its values
+     * @param source Dataset to restrict
+     * @param rows Rows to keep, over source->size() rows
+     * @return Dataset with the same columns and number of rows, where the rows
+     *         outside the selection read as nulls. Column values are shared
+     *         with source (see shareColumn); only the validity bitmaps are rebuilt.
+     * @throws std::invalid_argument if rows does not cover source->size() rows
+     * 
+     * Every analysis that skips nulls therefore runs over the selected rows only.
+     * The result does not see later changes to source, whose next append to a
+     * shared column copies that column first.
+     */
+    static Dataset where(std::shared_ptr<Dataset> source, const Selection& rows);
+
+    /**
+     * @brief Appends all rows of another dataset with the same columns
+     * @param other Dataset whose rows are appended after the existing ones
+     * @throws std::runtime_error if other lacks one of the columns of this dataset
+     */
+    void append(const Dataset& other);
+
 
     bool isNumericColumn(const std::string& columnName) const;
 
@@ -114,7 +327,30 @@ public:
 
 
 private:
-    std::vector<std::unordered_map<std::string, OptionalDataValue>> data;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, size_t> index;
+    std::vector<Column> columns;
+    size_t rows = 0;
+
+    /// Process-wide unique id, renewed whenever the dataset is copied or assigned
+    struct RevisionId {
+        RevisionId() : id(next()) {}
+        RevisionId(const RevisionId&) : id(next()) {}
+        RevisionId& operator=(const RevisionId&) {
+            id = next();
+            return *this;
+        }
+        static uint64_t next();
+        uint64_t id;
+    };
+    RevisionId revisionId;
+
+    struct CsvLoader;
+    struct BatchLoader;
+
+    void initSchema(const Row& row);
+    void initSchema(const std::vector<std::string>& columnNames);
+    void appendRow(const Row& row);
 
 
 
@@ -122,4 +358,4 @@ private:
 };
 }
 
-#endif // DATASET_HPP
\ No newline at end of file
+#endif // DATASET_HPP
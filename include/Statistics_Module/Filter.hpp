@@ -0,0 +1,85 @@
+#ifndef FILTER_HPP
+#define FILTER_HPP
+
+#include "Dataset.hpp"
+#include "Selection.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Row predicate over the columns of a Dataset, evaluated to a Selection
+ *
+ * @details
+ *   A filter is a small expression tree of column predicates combined with
+ *   &, | and ~. Evaluation works column-wise on the typed buffers:
+ *   - numeric comparisons are closed intervals, matched by the vectorized
+ *     Kernels::selectBetween straight into a bitmap and then ANDed with the
+ *     validity bitmap of the column;
+ *   - string equality and membership look the requested strings up once in the
+ *     column dictionary, so rows are matched by comparing integer codes;
+ *   - rows are processed in fixed chunks of 64Ki rows across threads.
+ *
+ *   Comparisons never select a null row (nor a NaN), and ~ is the plain
+ *   complement of a selection, so ~equal(c, v) also selects the nulls of c
+ *   whereas notEqual(c, v) does not.
+ *
+ * Usage example:
+ * @code
+ * Filter adults = Filter::greaterEqual("Age", 18) & Filter::equal("Gender", "Female");
+ * StatisticalAnalyzer subset = analyzer.where(adults);
+ * double m = subset.mean<double>("Calories");
+ * @endcode
+ */
+class Filter {
+public:
+    /// Rows equal to value (numbers compare numerically, strings exactly)
+    static Filter equal(const std::string& column, const DataValue& value);
+
+    /// Non-null rows that are not equal to value
+    static Filter notEqual(const std::string& column, const DataValue& value);
+
+    /// Numeric comparisons; string rows never match
+    static Filter less(const std::string& column, double value);
+    static Filter lessEqual(const std::string& column, double value);
+    static Filter greater(const std::string& column, double value);
+    static Filter greaterEqual(const std::string& column, double value);
+
+    /// Rows with lo <= value <= hi
+    static Filter between(const std::string& column, double lo, double hi);
+
+    /// Rows equal to any of values
+    static Filter isIn(const std::string& column, std::vector<DataValue> values);
+
+    static Filter isNull(const std::string& column);
+    static Filter notNull(const std::string& column);
+
+    Filter operator&(const Filter& other) const;
+    Filter operator|(const Filter& other) const;
+    Filter operator~() const;
+
+    /**
+     * @brief Computes the rows of a dataset matching the filter
+     * @param dataset Dataset to filter
+     * @param threads Number of threads, 0 for one per hardware thread
+     * @return Selection over dataset.size() rows
+     * @throws std::runtime_error if a column doesn't exist
+     * @throws std::invalid_argument if a numeric comparison targets a String column
+     */
+    Selection evaluate(const Dataset& dataset, unsigned threads = 1) const;
+
+private:
+    struct Node;
+
+    explicit Filter(std::shared_ptr<const Node> node) : node(std::move(node)) {}
+
+    static Selection evaluate(const Node& node, const Dataset& dataset, unsigned threads);
+
+    std::shared_ptr<const Node> node;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // FILTER_HPP
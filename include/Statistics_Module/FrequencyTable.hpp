@@ -0,0 +1,85 @@
+#ifndef FREQUENCY_TABLE_HPP
+#define FREQUENCY_TABLE_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Counts occurrences of keys in a flat open-addressing hash table
+ * 
+ * @details
+ *   Keys and counts live in two flat arrays indexed by slot (linear probing,
+ *   power-of-two capacity, load factor at most 1/2), so counting does one
+ *   hash and usually one cache line access per value, without the per-node
+ *   allocations of std::unordered_map. A count of zero marks an empty slot.
+ *   
+ *   Tables built over disjoint parts of the data (e.g. one per thread) are
+ *   combined with merge(). Floating-point keys are canonicalized: -0.0 counts
+ *   as 0.0 and all NaNs share one entry.
+ * 
+ * @tparam K Key type (int32_t, double or std::string)
+ */
+template <typename K>
+class FrequencyTable {
+public:
+    /**
+     * @brief Creates an empty table
+     * @param expectedKeys Number of distinct keys to reserve room for
+     */
+    explicit FrequencyTable(size_t expectedKeys = 0);
+
+    /// Adds count occurrences of key
+    void add(const K& key, size_t count = 1);
+
+    /// Adds the counts of another table into this one
+    void merge(const FrequencyTable& other);
+
+    /// Number of distinct keys
+    size_t size() const { return size_; }
+
+    /// Sum of all counts
+    size_t total() const { return total_; }
+
+    /// Count of a key (0 if absent)
+    size_t count(const K& key) const;
+
+    /**
+     * @brief Returns the k most frequent keys
+     * @return Up to k (key, count) pairs, by decreasing count; equal counts are
+     *         ordered by key, so the result does not depend on insertion order
+     */
+    std::vector<std::pair<K, size_t>> topK(size_t k) const;
+
+    /// All (key, count) pairs, ordered as topK
+    std::vector<std::pair<K, size_t>> entries() const { return topK(size_); }
+
+    /// Copies the counts into a std::unordered_map
+    std::unordered_map<K, size_t> toMap() const;
+
+    /// Calls f(key, count) for every distinct key, in unspecified order
+    template <typename F>
+    void forEach(F&& f) const {
+        for (size_t slot = 0; slot < counts_.size(); ++slot) {
+            if (counts_[slot] != 0) f(keys_[slot], counts_[slot]);
+        }
+    }
+
+private:
+    size_t slotOf(const K& key) const;
+    void rehash(size_t capacity);
+
+    std::vector<K> keys_;
+    std::vector<size_t> counts_;
+    size_t size_ = 0;
+    size_t total_ = 0;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // FREQUENCY_TABLE_HPP
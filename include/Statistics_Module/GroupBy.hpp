@@ -0,0 +1,122 @@
+#ifndef GROUP_BY_HPP
+#define GROUP_BY_HPP
+
+#include "Dataset.hpp"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Statistics that GroupBy::agg can compute per group
+ */
+enum class AggregateKind { Count, Sum, Mean, Variance, StandardDeviation, Min, Max, Quantile };
+
+/**
+ * @brief One aggregate requested from GroupBy::agg
+ * 
+ * Converts implicitly from AggregateKind, so specifications read as
+ * {"Calories", {AggregateKind::Mean, AggregateKind::Count, Aggregate::quantile(0.9)}}.
+ */
+struct Aggregate {
+    Aggregate(AggregateKind kind) : kind(kind) {}
+
+    /// Quantile with linear interpolation, probability in [0, 1]
+    static Aggregate quantile(double probability);
+
+    /**
+     * @brief Parses an aggregate name: count, sum, mean, var, std, min, max,
+     *        median, or pNN for the NN-th percentile (e.g. p90, p99.9)
+     * @throws std::invalid_argument for an unknown name
+     */
+    static Aggregate parse(const std::string& name);
+
+    /// Suffix of the output column: count, sum, mean, var, std, min, max or pNN
+    std::string suffix() const;
+
+    AggregateKind kind;
+    double probability = 0.5; ///< Only used by AggregateKind::Quantile
+};
+
+/// Aggregates to compute, as (column, aggregates) pairs in output order
+using AggregationSpec = std::vector<std::pair<std::string, std::vector<Aggregate>>>;
+
+/**
+ * @brief Rows of a Dataset grouped by the values of one or more key columns
+ * 
+ * @details
+ *   Grouping is a hash-based pass run once at construction:
+ *   - each key column is encoded as one dense integer code per row (string
+ *     columns reuse their dictionary codes, other columns are numbered through
+ *     a flat hash table), and multiple keys are combined pairwise;
+ *   - the rows are cut into one range per thread, each range numbers its keys
+ *     in a private flat table, and the tables are merged in row order, so group
+ *     ids follow the first appearance of each key whatever the thread count;
+ *   - a stable counting sort then lists the rows of every group contiguously.
+ *   
+ *   agg() gathers the values of each group into a contiguous buffer and
+ *   reduces it with the vectorized kernels used by StatisticalAnalyzer, with
+ *   groups partitioned across threads. Nulls form their own key and are
+ *   skipped by the aggregates.
+ * 
+ * Usage example:
+ * @code
+ * StatisticalAnalyzer analyzer(dataset, 0);
+ * Dataset perDiet = analyzer.groupBy({"Dietary Preference"})
+ *                           .agg({{"Calories", {AggregateKind::Mean, AggregateKind::Count}}});
+ * // Columns: "Dietary Preference", "Calories_mean", "Calories_count"
+ * @endcode
+ */
+class GroupBy {
+public:
+    /**
+     * @brief Groups the rows of a dataset
+     * @param dataset Dataset to group; kept alive by the GroupBy
+     * @param keys Key columns
+     * @param threads Number of threads, 0 for one per hardware thread
+     * @param rows Rows to group, or null for every row; the other rows belong
+     *        to no group
+     * @throws std::invalid_argument if no key is given or rows does not cover the dataset
+     * @throws std::runtime_error if a key column does not exist
+     */
+    GroupBy(std::shared_ptr<const Dataset> dataset, std::vector<std::string> keys, unsigned threads = 1,
+            const Selection* rows = nullptr);
+
+    /// Number of groups
+    size_t groups() const { return firstRow.size(); }
+
+    /// Group id of every row, ids numbered by first appearance (UINT32_MAX for unselected rows)
+    const std::vector<uint32_t>& groupIds() const { return rowGroup; }
+
+    /**
+     * @brief Computes aggregates per group
+     * @param spec Columns and aggregates to compute
+     * @return Dataset with one row per group (in order of first appearance): the
+     *         key columns, then one column named "<column>_<suffix>" per aggregate.
+     *         Aggregates of groups without values are null.
+     * @throws std::runtime_error if a column doesn't exist or two outputs get the same name
+     * @throws std::invalid_argument if a non-count aggregate targets a non-numeric column
+     */
+    Dataset agg(const AggregationSpec& spec) const;
+
+    /// Number of rows of every group, as the key columns plus a "count" column
+    Dataset size() const;
+
+private:
+    Dataset keyColumns() const;
+
+    std::shared_ptr<const Dataset> dataset;
+    std::vector<std::string> keys;
+    unsigned threads;
+    std::vector<uint32_t> rowGroup;  ///< Group of every row
+    std::vector<size_t> firstRow;    ///< First row of every group
+    std::vector<size_t> offsets;     ///< Rows of group g are sortedRows[offsets[g], offsets[g + 1])
+    std::vector<size_t> sortedRows;  ///< Row indices grouped by group, in row order within a group
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // GROUP_BY_HPP
@@ -0,0 +1,138 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Mergeable histogram of numeric values over fixed bins
+ *
+ * @details
+ *   Three layouts are supported:
+ *   - linear: equal-width bins over [lo, hi]; the bin of a value is computed
+ *     arithmetically by the branch-free, vectorized Kernels::binIndices;
+ *   - logarithmic: bins of equal width in log(x), i.e. with a constant ratio
+ *     between consecutive edges (latencies, sizes); values are mapped through
+ *     log and binned the same way;
+ *   - explicit edges: any strictly increasing edges (e.g. quantiles), the bin
+ *     being found by a branch-free binary search with a fixed number of steps.
+ *
+ *   Bin b covers [edges()[b], edges()[b + 1]), the last bin also holding the
+ *   upper edge. Values below the first edge, above the last one, and NaNs are
+ *   counted apart (underflow, overflow, nanCount) rather than dropped.
+ *
+ *   Counts are plain integers, so histograms with the same bins built over
+ *   different parts of the data (threads, files, days) merge exactly.
+ *
+ * Usage example:
+ * @code
+ * Histogram latency = Histogram::logarithmic(0.1, 10000.0, 200);
+ * latency.add(samples.data(), samples.size());
+ * double p99 = latency.quantile(0.99);
+ * @endcode
+ */
+class Histogram {
+public:
+    /// How the bins of a histogram are laid out
+    enum class Scale { Linear, Log, Edges };
+
+    /**
+     * @brief Equal-width bins over [lo, hi]
+     * @throws std::invalid_argument unless lo < hi are finite and 0 < bins < 2^31 - 2
+     */
+    static Histogram linear(double lo, double hi, size_t bins);
+
+    /**
+     * @brief Bins of equal width in log scale over [lo, hi]
+     * @throws std::invalid_argument unless 0 < lo < hi are finite and 0 < bins < 2^31 - 2
+     */
+    static Histogram logarithmic(double lo, double hi, size_t bins);
+
+    /**
+     * @brief Bins between consecutive edges
+     * @param edges At least two finite, strictly increasing values
+     * @throws std::invalid_argument if the edges are not valid
+     */
+    static Histogram fromEdges(std::vector<double> edges);
+
+    /// Adds one value
+    void add(double value);
+
+    /**
+     * @brief Adds n values in blocks
+     * @param values n values
+     * @param n Number of values
+     * @param validity Bitmap of the values to count, bit i of word i / 64 for
+     *        values[i] (the layout of Column validity bitmaps), or nullptr to
+     *        count every value
+     */
+    void add(const double* values, size_t n, const uint64_t* validity = nullptr);
+
+    /**
+     * @brief Adds the counts of another histogram into this one
+     * @throws std::invalid_argument if the bins differ
+     */
+    void merge(const Histogram& other);
+
+    /// Resets every count to zero, keeping the bins
+    void clear();
+
+    Scale scale() const { return scale_; }
+
+    /// Number of bins
+    size_t bins() const { return counts_.size(); }
+
+    /// bins() + 1 bin edges, increasing
+    const std::vector<double>& edges() const { return edges_; }
+
+    /// Count of each bin
+    const std::vector<uint64_t>& counts() const { return counts_; }
+
+    /// Values below the first edge
+    uint64_t underflow() const { return underflow_; }
+
+    /// Values above the last edge
+    uint64_t overflow() const { return overflow_; }
+
+    /// NaN values
+    uint64_t nanCount() const { return nan_; }
+
+    /// Values inside the bins (underflow, overflow and NaNs excluded)
+    uint64_t total() const { return total_; }
+
+    /**
+     * @brief Approximate quantile of the values inside the bins
+     *
+     * Finds the bin holding the requested rank and interpolates within it,
+     * linearly (geometrically for logarithmic bins). The error is at most the
+     * width of that bin.
+     *
+     * @param probability Probability in [0, 1]
+     * @throws std::invalid_argument if probability is outside [0, 1]
+     * @throws std::runtime_error if no value lies inside the bins
+     */
+    double quantile(double probability) const;
+
+private:
+    Histogram(Scale scale, std::vector<double> edges);
+
+    /// Slot of each value: 0 underflow, b + 1 bin b, bins + 1 overflow, bins + 2 NaN
+    void slotsOf(const double* values, size_t n, uint32_t* slots) const;
+
+    Scale scale_;
+    std::vector<double> edges_;
+    double lo_;     ///< Lower bound handed to the kernel (log of it for Log)
+    double hi_;     ///< Upper bound handed to the kernel (log of it for Log)
+    std::vector<uint64_t> counts_;
+    uint64_t underflow_ = 0;
+    uint64_t overflow_ = 0;
+    uint64_t nan_ = 0;
+    uint64_t total_ = 0;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // HISTOGRAM_HPP
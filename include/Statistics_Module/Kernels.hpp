@@ -0,0 +1,100 @@
+#ifndef KERNELS_HPP
+#define KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics::Kernels {
+
+/**
+ * @brief Instruction sets the reduction kernels can run on
+ */
+enum class Isa { Scalar, AVX2, AVX512 };
+
+/**
+ * @brief Instruction set used by the kernels
+ * 
+ * Picked once at runtime: the widest of AVX-512, AVX2 and the portable scalar
+ * code supported by the CPU (x86-64 builds with GCC or Clang only; every
+ * other build always uses the scalar code).
+ */
+Isa activeIsa();
+
+/// True if the CPU (and the build) can run the kernels with the given instruction set
+bool isSupported(Isa isa);
+
+/**
+ * @brief Forces the kernels onto an instruction set, e.g. to compare implementations
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+void setIsa(Isa isa);
+
+/// Human-readable name of an instruction set
+const char* isaName(Isa isa);
+
+/**
+ * @brief Plain sum over several independent vector accumulators
+ * 
+ * Fastest reduction; splitting the sum over lanes already reduces the
+ * rounding error growth compared to a single running sum.
+ */
+double sum(const double* x, size_t n);
+
+/**
+ * @brief Compensated sum (Kahan-Babuska/Neumaier on every vector lane)
+ * 
+ * Each lane carries the rounding error of its running sum, and the lanes are
+ * combined with the same compensation, so the error does not grow with n.
+ * Relies on strict IEEE semantics: do not build with -ffast-math.
+ */
+double compensatedSum(const double* x, size_t n);
+
+/**
+ * @brief Sum of squared deviations from a center, sum((x - center)^2)
+ * 
+ * With center = mean this is the numerator of the variance (the two-pass
+ * algorithm), which avoids the cancellation of sum(x^2) - n * mean^2.
+ */
+double sumSquaredDeviations(const double* x, size_t n, double center);
+
+/**
+ * @brief Minimum and maximum in one pass
+ * @param x Values (n > 0)
+ * @param n Number of values
+ * @param min Output: smallest value
+ * @param max Output: largest value
+ */
+void minMax(const double* x, size_t n, double& min, double& max);
+
+/**
+ * @brief Marks the values that lie in a closed interval
+ * @param x Values
+ * @param n Number of values
+ * @param lo Lower bound (inclusive)
+ * @param hi Upper bound (inclusive)
+ * @param bits Output: (n + 63) / 64 words; bit i is set iff lo <= x[i] <= hi
+ *        (never for NaN), bits past n are cleared
+ */
+void selectBetween(const double* x, size_t n, double lo, double hi, uint64_t* bits);
+void selectBetween(const int32_t* x, size_t n, int32_t lo, int32_t hi, uint64_t* bits);
+
+/**
+ * @brief Histogram slot of each value for equal-width bins over [lo, hi]
+ * 
+ * Bin b covers [lo + b * w, lo + (b + 1) * w) with w = (hi - lo) / bins, and
+ * the last bin also holds hi. Slots are computed without branches (clamps and
+ * blends only): 0 for x < lo, b + 1 for bin b, bins + 1 for x > hi and
+ * bins + 2 for NaN.
+ * 
+ * @param x Values
+ * @param n Number of values
+ * @param lo Lower bound, finite
+ * @param hi Upper bound, finite and greater than lo
+ * @param bins Number of bins, below 2^31 - 2
+ * @param slots Output: n slot indices
+ */
+void binIndices(const double* x, size_t n, double lo, double hi, uint32_t bins, uint32_t* slots);
+
+} // namespace ScientificToolbox::Statistics::Kernels
+
+#endif // KERNELS_HPP
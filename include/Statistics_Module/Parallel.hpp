@@ -0,0 +1,79 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Resolves a requested thread count
+ * @param threads Requested number of threads, 0 for one per hardware thread
+ * @return Number of threads to use (at least 1)
+ */
+inline unsigned resolveThreads(unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max(threads, 1u);
+}
+
+/**
+ * @brief Runs task(i) for every i in [0, tasks) on up to `threads` threads
+ * 
+ * Workers pull task indices from a shared counter, so uneven tasks balance
+ * themselves. Each task must write its result to its own slot: combining the
+ * slots afterwards in index order keeps results independent of the thread
+ * count and of scheduling. With one thread (or one task) everything runs on
+ * the calling thread.
+ * 
+ * @param tasks Number of tasks
+ * @param threads Number of threads, 0 for one per hardware thread
+ * @param task Callable invoked with the task index
+ * @throws Rethrows the exception of the lowest-index failing task, after all workers finished
+ */
+template <typename Task>
+void parallelFor(size_t tasks, unsigned threads, Task&& task) {
+    const size_t workers = std::min<size_t>(resolveThreads(threads), tasks);
+    if (workers <= 1) {
+        for (size_t i = 0; i < tasks; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(tasks);
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+        for (size_t i = next++; i < tasks; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (size_t w = 1; w < workers; ++w) {
+        pool.emplace_back(work);
+    }
+    work();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,101 @@
+#ifndef QUANTILE_SKETCH_HPP
+#define QUANTILE_SKETCH_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Mergeable approximate quantile sketch (KLL)
+ * 
+ * The sketch keeps a hierarchy of compactors: level h holds items standing for
+ * 2^h input values. When a level is full it is sorted and every other item is
+ * promoted to the next level, so the retained state grows only logarithmically
+ * with the number of values (a few KB for k = 200) while the rank error of any
+ * quantile query stays around 1.7 / k of the count, independent of the data.
+ * 
+ * Sketches built over different shards of the data can be merged, and they can
+ * be serialized to a compact byte string to be shipped between processes.
+ * The minimum and maximum are tracked exactly. Compaction uses a fixed-seed
+ * generator, so building the same sketch twice gives the same result.
+ * 
+ * Usage example:
+ * @code
+ * QuantileSketch sketch;
+ * for (double x : values) sketch.update(x);
+ * double p99 = sketch.quantile(0.99);
+ * @endcode
+ */
+class QuantileSketch {
+public:
+    /**
+     * @brief Creates an empty sketch
+     * @param k Accuracy parameter (capacity of the top compactor); larger is more accurate
+     * @throws std::invalid_argument if k < 8
+     */
+    explicit QuantileSketch(uint16_t k = 200);
+
+    /// Adds one value
+    void update(double value);
+
+    /**
+     * @brief Merges another sketch into this one
+     * @throws std::invalid_argument if the sketches use different k
+     */
+    void merge(const QuantileSketch& other);
+
+    /// Number of values summarized
+    uint64_t count() const { return n; }
+    bool empty() const { return n == 0; }
+    uint16_t k() const { return capacity; }
+
+    /// Number of values currently retained
+    size_t retained() const;
+
+    double min() const;
+    double max() const;
+
+    /**
+     * @brief Approximate quantile
+     * @param probability Probability in [0, 1]
+     * @throws std::runtime_error if the sketch is empty
+     * @throws std::invalid_argument if probability is outside [0, 1]
+     */
+    double quantile(double probability) const;
+
+    /// Approximate quantiles for several probabilities, sorting the retained items once
+    std::vector<double> quantiles(const std::vector<double>& probabilities) const;
+
+    /// Approximate fraction of values less than or equal to value
+    double rank(double value) const;
+
+    /// Serializes the sketch to a byte string
+    std::string serialize() const;
+
+    /**
+     * @brief Rebuilds a sketch from serialize() output
+     * @throws std::runtime_error if the bytes are not a valid sketch
+     */
+    static QuantileSketch deserialize(const std::string& bytes);
+
+private:
+    uint16_t capacity;
+    uint64_t n = 0;
+    double lo;
+    double hi;
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    std::vector<std::vector<double>> levels;
+
+    size_t levelCapacity(size_t level) const;
+    size_t totalCapacity() const;
+    void compress();
+    bool coinFlip();
+    std::vector<std::pair<double, uint64_t>> weightedItems() const;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // QUANTILE_SKETCH_HPP
@@ -0,0 +1,41 @@
+#ifndef QUANTILES_HPP
+#define QUANTILES_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Computes several quantiles of a buffer by selection, reordering it in place
+ * 
+ * @details
+ *   Instead of sorting the whole buffer, only the order statistics needed by
+ *   the requested quantiles are placed with std::nth_element (introselect).
+ *   The ranks are selected divide-and-conquer: the middle rank partitions the
+ *   buffer and the lower and upper ranks are searched only in their side, so
+ *   k quantiles cost O(n log k) instead of O(n log n).
+ *   
+ *   Quantiles use linear interpolation between order statistics
+ *   (h = p * (n - 1)), so p = 0.5 gives the usual median.
+ * 
+ * @tparam T Element type (int or double)
+ * @param data Values; left partially ordered on return
+ * @param probabilities Probabilities in [0, 1], in any order
+ * @return Quantiles in the order of probabilities
+ * 
+ * @throws std::invalid_argument if data is empty or a probability is outside [0, 1]
+ */
+template <typename T>
+std::vector<double> quantilesInPlace(std::vector<T>& data, const std::vector<double>& probabilities);
+
+/**
+ * @brief Computes one quantile of a buffer by selection, reordering it in place
+ * @see quantilesInPlace
+ */
+template <typename T>
+double quantileInPlace(std::vector<T>& data, double probability);
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // QUANTILES_HPP
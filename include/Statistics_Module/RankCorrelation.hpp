@@ -0,0 +1,86 @@
+#ifndef RANK_CORRELATION_HPP
+#define RANK_CORRELATION_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Ranking of one variable, computed once and reused for every pair it appears in
+ * 
+ * @details
+ *   Holds everything the rank correlations need from a single column:
+ *   - centered average ranks (ties share the mean of their ranks), for Spearman
+ *   - dense ranks and the sort order of the values, for Kendall
+ *   - the number of tied pairs, sum t(t - 1) / 2 over groups of ties
+ *   
+ *   Building it sorts the values once, O(n log n).
+ */
+class RankedColumn {
+public:
+    RankedColumn() = default;
+
+    /**
+     * @brief Ranks a vector of values
+     * @param values Values to rank (no NaN)
+     */
+    explicit RankedColumn(const std::vector<double>& values);
+
+    size_t size() const { return order_.size(); }
+
+    /// Average ranks minus their mean (n + 1) / 2
+    const std::vector<double>& centeredRanks() const { return centered_; }
+
+    /// Sum of the squared centered ranks
+    double rankSumSquares() const { return sumSquares_; }
+
+    /// Dense ranks: 0 for the smallest value, equal values share a rank
+    const std::vector<uint32_t>& denseRanks() const { return dense_; }
+
+    /// Indices of the values in ascending order
+    const std::vector<uint32_t>& order() const { return order_; }
+
+    /// Number of pairs of tied values
+    double tiedPairs() const { return tiedPairs_; }
+
+private:
+    std::vector<double> centered_;
+    std::vector<uint32_t> dense_;
+    std::vector<uint32_t> order_;
+    double sumSquares_ = 0.0;
+    double tiedPairs_ = 0.0;
+};
+
+/**
+ * @brief Spearman's rank correlation of two ranked variables over the same observations
+ * @return Pearson correlation of the average ranks (NaN if a variable is constant)
+ * @throws std::invalid_argument if the sizes differ
+ */
+double spearmanCorrelation(const RankedColumn& x, const RankedColumn& y);
+
+/**
+ * @brief Kendall's tau-b of two ranked variables over the same observations
+ * 
+ * @details
+ *   Knight's algorithm: the observations are ordered by (x, y), and the
+ *   discordant pairs are the inversions of the resulting y sequence, counted
+ *   while merge-sorting it. Ties are corrected as in tau-b:
+ *   tau = (n0 - n1 - n2 + n3 - 2 * swaps) / sqrt((n0 - n1)(n0 - n2)).
+ *   Runs in O(n log n) instead of comparing all O(n^2) pairs.
+ * 
+ * @return Tau-b in [-1, 1] (NaN if a variable is constant)
+ * @throws std::invalid_argument if the sizes differ
+ */
+double kendallTau(const RankedColumn& x, const RankedColumn& y);
+
+/// Spearman's rank correlation of two vectors of values
+double spearmanCorrelation(const std::vector<double>& x, const std::vector<double>& y);
+
+/// Kendall's tau-b of two vectors of values
+double kendallTau(const std::vector<double>& x, const std::vector<double>& y);
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // RANK_CORRELATION_HPP
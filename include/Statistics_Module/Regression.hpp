@@ -0,0 +1,105 @@
+#ifndef REGRESSION_HPP
+#define REGRESSION_HPP
+
+#include "Accumulators.hpp"
+#include <Eigen/Dense>
+#include <string>
+#include <vector>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Fitted linear model y = intercept + x^T coefficients, as returned by LinearRegression::fit
+ */
+struct RegressionResult {
+    std::vector<std::string> predictors;  ///< Names of the predictors (empty if fitted from raw rows)
+    Eigen::VectorXd coefficients;         ///< One coefficient per predictor
+    Eigen::VectorXd standardErrors;       ///< Standard error of each coefficient
+    double intercept = 0.0;               ///< Intercept (0 when fitted without one)
+    double interceptStandardError = 0.0;  ///< Standard error of the intercept (NaN when fitted without one)
+    double rSquared = 0.0;                ///< Coefficient of determination (uncentered without intercept)
+    double adjustedRSquared = 0.0;        ///< rSquared adjusted for the number of predictors
+    double residualStandardError = 0.0;   ///< sqrt(residual sum of squares / residual degrees of freedom)
+    size_t observations = 0;              ///< Number of complete rows used
+    double ridge = 0.0;                   ///< Ridge penalty used
+};
+
+/**
+ * @brief Single-pass, mergeable least-squares regression (OLS and ridge)
+ *
+ * The rows (x, y) are never stored: the accumulator keeps the count, the means
+ * and the centered co-moments of (x, y) (a CoMoments over predictors + 1
+ * variables), i.e. X^T X and X^T y after centering. Rows can be pushed one at
+ * a time or in blocks, from any number of batches, and accumulators built over
+ * different parts of the data are merged, so memory is O(predictors^2)
+ * whatever the number of rows.
+ *
+ * fit() solves the normal equations (X^T X + ridge * I) b = X^T y on the
+ * centered sums, which keeps the intercept out of the penalty and avoids the
+ * loss of precision of raw sums. The system is scaled to a unit diagonal and
+ * solved by Cholesky; if it is too ill-conditioned, a rank-revealing QR
+ * decomposition takes over and reports collinear predictors.
+ *
+ * Usage example:
+ * @code
+ * LinearRegression model(2);
+ * for (const auto& batch : batches) model.pushBlock(batch); // columns x1, x2, y
+ * RegressionResult fit = model.fit();
+ * @endcode
+ */
+class LinearRegression {
+public:
+    /**
+     * @brief Creates an empty accumulator
+     * @param predictors Number of predictors (columns of x)
+     * @throws std::invalid_argument if predictors is 0
+     */
+    explicit LinearRegression(size_t predictors);
+
+    /**
+     * @brief Creates an accumulator from co-moments already gathered
+     * @param moments Co-moments of the predictors followed by the response
+     * @throws std::invalid_argument if moments has fewer than two variables
+     */
+    explicit LinearRegression(CoMoments moments);
+
+    /// Adds one row; ignored if x or y holds a NaN
+    void push(const Eigen::Ref<const Eigen::VectorXd>& x, double y);
+
+    /**
+     * @brief Adds a block of rows
+     * @param rows rows x (predictors + 1) matrix: the predictors, then the
+     *        response in the last column; rows holding a NaN are skipped
+     */
+    void pushBlock(const Eigen::Ref<const Eigen::MatrixXd>& rows);
+
+    /**
+     * @brief Combines another accumulator over the same predictors into this one
+     * @throws std::invalid_argument if the numbers of predictors differ
+     */
+    void merge(const LinearRegression& other);
+
+    size_t predictors() const { return moments.dims() - 1; }
+
+    /// Number of complete rows added
+    size_t count() const { return moments.count(); }
+
+    /**
+     * @brief Solves the least-squares problem for the rows added so far
+     * @param ridge Penalty on the squared norm of the coefficients (0 for OLS);
+     *        it applies to the coefficients in the units of the predictors
+     * @param intercept Whether to fit an intercept
+     * @return Coefficients, standard errors and goodness of fit
+     * @throws std::invalid_argument if ridge is negative or not finite
+     * @throws std::runtime_error if there are not more rows than parameters,
+     *         or if the predictors are collinear
+     */
+    RegressionResult fit(double ridge = 0.0, bool intercept = true) const;
+
+private:
+    CoMoments moments;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // REGRESSION_HPP
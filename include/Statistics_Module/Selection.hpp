@@ -0,0 +1,110 @@
+#ifndef SELECTION_HPP
+#define SELECTION_HPP
+
+#include <vector>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Set of selected rows of a Dataset, stored as a bitmap
+ *
+ * Uses the same layout as the validity bitmaps of Column (bit i of word
+ * i / 64 for row i, bits past the last row cleared), so a selection can be
+ * combined with them word by word. Produced by Filter::evaluate and consumed
+ * by Dataset::where and StatisticalAnalyzer::where.
+ */
+class Selection {
+public:
+    Selection() = default;
+
+    /// Selection over rows rows, with every row selected if all is true
+    explicit Selection(size_t rows, bool all = false)
+        : rows_(rows), bits_((rows + 63) / 64, all ? ~uint64_t{0} : 0) {
+        clearTail();
+    }
+
+    /**
+     * @brief Wraps an existing bitmap
+     * @throws std::invalid_argument if bits does not hold (rows + 63) / 64 words
+     */
+    Selection(std::vector<uint64_t> bits, size_t rows) : rows_(rows), bits_(std::move(bits)) {
+        if (bits_.size() != (rows + 63) / 64) {
+            throw std::invalid_argument("Selection bitmap does not match the number of rows");
+        }
+        clearTail();
+    }
+
+    /// Number of rows covered (selected or not)
+    size_t rows() const { return rows_; }
+
+    /// Number of selected rows
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t word : bits_) total += std::bitset<64>(word).count();
+        return total;
+    }
+
+    bool contains(size_t row) const { return (bits_[row >> 6] >> (row & 63)) & 1u; }
+
+    const std::vector<uint64_t>& bits() const { return bits_; }
+    std::vector<uint64_t>& bits() { return bits_; }
+
+    /// Selection vector: indices of the selected rows in increasing order
+    std::vector<size_t> indices() const {
+        std::vector<size_t> out;
+        out.reserve(count());
+        for (size_t w = 0; w < bits_.size(); ++w) {
+            for (uint64_t word = bits_[w]; word != 0; word &= word - 1) {
+                out.push_back(w * 64 + static_cast<size_t>(std::bitset<64>((word & -word) - 1).count()));
+            }
+        }
+        return out;
+    }
+
+    Selection& operator&=(const Selection& other) {
+        checkRows(other);
+        for (size_t w = 0; w < bits_.size(); ++w) bits_[w] &= other.bits_[w];
+        return *this;
+    }
+
+    Selection& operator|=(const Selection& other) {
+        checkRows(other);
+        for (size_t w = 0; w < bits_.size(); ++w) bits_[w] |= other.bits_[w];
+        return *this;
+    }
+
+    /// Complement: the rows that are not selected
+    Selection operator~() const {
+        Selection out(*this);
+        for (auto& word : out.bits_) word = ~word;
+        out.clearTail();
+        return out;
+    }
+
+    friend Selection operator&(Selection a, const Selection& b) { return a &= b; }
+    friend Selection operator|(Selection a, const Selection& b) { return a |= b; }
+
+private:
+    void clearTail() {
+        if (rows_ & 63) {
+            bits_.back() &= (uint64_t{1} << (rows_ & 63)) - 1;
+        }
+    }
+
+    void checkRows(const Selection& other) const {
+        if (other.rows_ != rows_) {
+            throw std::invalid_argument("Selections cover a different number of rows");
+        }
+    }
+
+    size_t rows_ = 0;
+    std::vector<uint64_t> bits_;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // SELECTION_HPP
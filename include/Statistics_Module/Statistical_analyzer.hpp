@@ -2,8 +2,52 @@
 #define STATISTICAL_ANALYZER_HPP
 
 #include "Dataset.hpp"
+#include "Quantiles.hpp"
+#include "QuantileSketch.hpp"
+#include "Parallel.hpp"
+#include "Accumulators.hpp"
+#include "RankCorrelation.hpp"
+#include "FrequencyTable.hpp"
+#include "GroupBy.hpp"
+#include "Filter.hpp"
+#include "Histogram.hpp"
+#include "CardinalitySketch.hpp"
+#include "Regression.hpp"
 #include <Eigen/Dense>
 namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Descriptive statistics of one column, as returned by StatisticalAnalyzer::describe
+ */
+struct ColumnSummary {
+    std::string column;             ///< Name of the column
+    size_t count = 0;               ///< Number of non-null values
+    double mean = 0.0;              ///< Arithmetic mean
+    double variance = 0.0;          ///< Population variance
+    double standardDeviation = 0.0; ///< Square root of the variance
+    double min = 0.0;               ///< Smallest value
+    double max = 0.0;               ///< Largest value
+    std::vector<double> probabilities; ///< Probabilities of the requested quantiles
+    std::vector<double> quantiles;     ///< Quantiles matching probabilities (linear interpolation)
+};
+
+/**
+ * @brief How correlation methods treat missing (null) values
+ */
+enum class MissingPolicy {
+    Propagate,       ///< Nulls enter the computation as NaN and poison the affected coefficients
+    PairwiseComplete ///< Each pair of columns uses the rows where both values are present
+};
+
+/**
+ * @brief How StatisticalAnalyzer::histogram places the bins of a column
+ */
+enum class Binning {
+    Linear,  ///< Equal-width bins between the smallest and largest value
+    Log,     ///< Bins of equal width in log scale between the smallest positive and the largest value
+    Quantile ///< Bins holding about the same number of values, edges from a sample of the rows
+};
+
 /**
  * @brief A class for performing statistical analysis on datasets
  * 
@@ -13,9 +57,29 @@ namespace ScientificToolbox::Statistics {
  * 
  * This class offers following statistical operations:
  * - Basic statistical measures (mean, median, variance, standard deviation)
+ * - Quantiles, percentiles and IQR by selection rather than sorting
+ * - Approximate quantiles from mergeable sketches with bounded memory
+ * - Fused descriptive summaries of many columns (describe)
  * - Frequency analysis for categorical data
- * - Correlation analysis between multiple variables
+ * - Approximate distinct counts in constant memory (HyperLogLog sketches)
+ * - Histograms of numeric columns with linear, log-scale or quantile bins
+ * - Per-category aggregates (groupBy(...).agg(...))
+ * - Analysis restricted to the rows matching a Filter (where(...))
+ * - Correlation analysis between multiple variables (Pearson, Spearman, Kendall)
+ * - Least-squares linear regression (OLS and ridge) over named columns
  * 
+ * Numeric reductions run on a configurable number of threads: columns are
+ * processed concurrently, and long columns are cut into fixed-size chunks
+ * whose partial results are combined in chunk order. Results are therefore
+ * identical for every thread count.
+ * 
+ * The partial results of complete chunks (and of complete row stripes for
+ * correlationMatrix and regression) are cached per column and per set of
+ * columns. While the dataset only grows (see Dataset::revision), a repeated
+ * mean, variance, correlation or regression query folds in the appended
+ * rows and recomputes the last, incomplete chunk only, and returns exactly
+ * what a fresh analyzer would (pairwise-complete correlations excepted, see
+ * correlationMatrix).
  * 
  * 
  * @see Dataset
@@ -25,8 +89,15 @@ public:
     /**
      * @brief Constructs a StatisticalAnalyzer with a shared pointer to a Dataset
      * @param dataset Shared pointer to the Dataset to be analyzed
+     * @param threads Number of threads used by the analysis, 0 for one per hardware thread
      */
-    explicit StatisticalAnalyzer(std::shared_ptr<Dataset> dataset);
+    explicit StatisticalAnalyzer(std::shared_ptr<Dataset> dataset, unsigned threads = 1);
+
+    /// Sets the number of threads used by the analysis (0 for one per hardware thread)
+    void setThreads(unsigned threads) { threadCount = resolveThreads(threads); }
+
+    /// Number of threads used by the analysis
+    unsigned threads() const { return threadCount; }
 
     /**
      * @brief Calculates the arithmetic mean of a specified column
@@ -48,6 +119,71 @@ public:
     template<typename T>
     double median(const std::string& columnName) const;
     
+    /**
+     * @brief Calculates several quantiles of a specified column from one buffer
+     * @tparam T Data type of the column
+     * @param columnName Name of the column to analyze
+     * @param probabilities Probabilities in [0, 1]
+     * @return Quantiles in the order of probabilities (linear interpolation)
+     * @throws std::invalid_argument if a probability is outside [0, 1]
+     * @see quantilesInPlace for the in-place variant working on a caller-owned buffer
+     */
+    template<typename T>
+    std::vector<double> quantiles(const std::string& columnName, const std::vector<double>& probabilities) const;
+
+    /**
+     * @brief Calculates one quantile of a specified column
+     * @tparam T Data type of the column
+     * @param columnName Name of the column to analyze
+     * @param probability Probability in [0, 1]
+     * @return Double representing the quantile
+     */
+    template<typename T>
+    double quantile(const std::string& columnName, double probability) const;
+
+    /**
+     * @brief Calculates one percentile of a specified column
+     * @tparam T Data type of the column
+     * @param columnName Name of the column to analyze
+     * @param percent Percentile in [0, 100] (e.g. 99 for p99)
+     * @return Double representing the percentile
+     */
+    template<typename T>
+    double percentile(const std::string& columnName, double percent) const;
+
+    /**
+     * @brief Calculates the interquartile range (Q3 - Q1) of a specified column
+     * @tparam T Data type of the column
+     * @param columnName Name of the column to analyze
+     * @return Double representing the interquartile range
+     */
+    template<typename T>
+    double interquartileRange(const std::string& columnName) const;
+
+    /**
+     * @brief Builds a mergeable quantile sketch over a numeric column
+     * @param columnName Name of the column to summarize
+     * @param k Accuracy parameter of the sketch
+     * @return QuantileSketch fed with every non-null value of the column
+     * @throws std::runtime_error if the column doesn't exist or is not numeric
+     */
+    QuantileSketch quantileSketch(const std::string& columnName, uint16_t k = 200) const;
+
+    /**
+     * @brief Approximate quantile of a numeric column, computed from a sketch
+     * @param columnName Name of the column to analyze
+     * @param probability Probability in [0, 1]
+     * @param k Accuracy parameter of the sketch (rank error about 1.7 / k)
+     * @return Double representing the approximate quantile
+     */
+    double approxQuantile(const std::string& columnName, double probability, uint16_t k = 200) const;
+
+    /**
+     * @brief Approximate median of a numeric column, computed from a sketch
+     * @see approxQuantile
+     */
+    double approxMedian(const std::string& columnName, uint16_t k = 200) const;
+
     /**
      * @brief Calculates the variance of a specified column
      * @tparam T Data type of the column
@@ -68,23 +204,223 @@ public:
     template<typename T>
     double standardDeviation(const std::string& columnName) const;
     
+    /**
+     * @brief Computes count, mean, variance, standard deviation, min, max and quantiles of columns
+     * @param columnNames Columns to summarize
+     * @param probabilities Probabilities in [0, 1] of the quantiles to compute
+     *        (default: quartiles)
+     * @return One ColumnSummary per column, in the order of columnNames
+     * @throws std::runtime_error if a column doesn't exist or has no numeric data
+     * @throws std::invalid_argument if a probability is outside [0, 1]
+     * 
+     * Each column is extracted once and all statistics are computed from that
+     * single buffer, instead of one extraction per statistic. Columns and
+     * chunks of long columns are processed in parallel (see threads()).
+     */
+    std::vector<ColumnSummary> describe(const std::vector<std::string>& columnNames,
+                                        const std::vector<double>& probabilities = {0.25, 0.5, 0.75}) const;
+
     /**
      * @brief Computes frequency distribution of values in a specified column
      * @tparam T Data type of the column
      * @param columnName Name of the column to analyze
      * @return Unordered map containing value-frequency pairs
-     * @throws std::invalid_argument if column doesn't exist or type mismatch
+     * @throws std::runtime_error if column doesn't exist or type mismatch
+     * @see frequencyTable, which avoids the conversion to std::unordered_map
      */
     template<typename T>
     std::unordered_map<T, size_t> frequencyCount(const std::string& columnName) const;
+
+    /**
+     * @brief Counts the occurrences of every distinct value in a specified column
+     * @tparam T double or std::string
+     * @param columnName Name of the column to analyze
+     * @return FrequencyTable with one entry per distinct non-null value
+     * @throws std::runtime_error if column doesn't exist or has no value of type T
+     * 
+     * String columns are counted by dictionary code into dense arrays, as are
+     * Int columns with a small value range; other columns use flat hash tables.
+     * Each thread counts a contiguous part of the rows into its own array or
+     * table, and the partial counts are merged at the end.
+     */
+    template<typename T>
+    FrequencyTable<T> frequencyTable(const std::string& columnName) const;
+
+    /**
+     * @brief Builds a mergeable distinct-count sketch over a column
+     * @param columnName Name of the column to summarize
+     * @param precision log2 of the number of registers of the sketch, in [4, 18]
+     * @return CardinalitySketch fed with every non-null value of the column
+     * @throws std::runtime_error if the column doesn't exist
+     * @throws std::invalid_argument if precision is out of range
+     * 
+     * Each thread sketches a contiguous part of the rows and the sketches are
+     * merged. String columns hash each dictionary entry used by a row once,
+     * instead of once per row.
+     */
+    CardinalitySketch cardinalitySketch(const std::string& columnName, uint8_t precision = 14) const;
+
+    /**
+     * @brief Approximate number of distinct non-null values of a column
+     * @param columnName Name of the column to analyze
+     * @param precision log2 of the number of registers of the sketch
+     *        (relative error about 1.04 / sqrt(2^precision), exact for small counts)
+     * @see cardinalitySketch
+     */
+    uint64_t approxDistinctCount(const std::string& columnName, uint8_t precision = 14) const;
+
+    /**
+     * @brief Returns the k most frequent values of a specified column
+     * @tparam T double or std::string
+     * @param columnName Name of the column to analyze
+     * @param k Number of values to return
+     * @return Up to k (value, count) pairs by decreasing count; equal counts are ordered by value
+     * @throws std::runtime_error if column doesn't exist or has no value of type T
+     */
+    template<typename T>
+    std::vector<std::pair<T, size_t>> mostFrequent(const std::string& columnName, size_t k) const;
+
+    /**
+     * @brief Histogram of a numeric column, with bins fitted to its values
+     * @param columnName Name of the column to analyze
+     * @param bins Number of bins
+     * @param binning Layout of the bins (see Binning)
+     * @return Histogram of the non-null values of the column
+     * @throws std::runtime_error if the column doesn't exist, is not numeric or has no value
+     * @throws std::invalid_argument if bins is 0, or with Binning::Log if no value is positive
+     * 
+     * The outer edges are the smallest and largest finite values, found by a
+     * first parallel pass. Binning::Quantile takes the inner edges from about
+     * 2^20 evenly spaced rows and collapses tied edges, so it may return fewer
+     * bins. Infinities, and non-positive values with Binning::Log, land in the
+     * underflow and overflow. If every value is the same, the range is
+     * widened around it.
+     */
+    Histogram histogram(const std::string& columnName, size_t bins, Binning binning = Binning::Linear) const;
+
+    /**
+     * @brief Adds the values of a numeric column to a histogram with given bins
+     * @param columnName Name of the column to analyze
+     * @param bins Histogram whose bins are used; its counts are kept and added to
+     * @return bins with the non-null values of the column added
+     * @throws std::runtime_error if the column doesn't exist or is not numeric
+     * 
+     * Each thread bins a contiguous range of rows into its own histogram with
+     * the vectorized kernels, and the partial histograms are merged at the
+     * end. Fixed bins make the results of different datasets (or days) mergeable.
+     */
+    Histogram histogram(const std::string& columnName, Histogram bins) const;
+
+    /**
+     * @brief Analyzer over the selected rows only
+     * @param rows Rows to keep, over the rows of the dataset
+     * @return Analyzer on the same threads whose dataset shares the column
+     *         buffers of this one, with the unselected rows masked as nulls
+     *         (see Dataset::where); groupBy() ignores the unselected rows.
+     * @throws std::invalid_argument if rows does not cover the dataset
+     * 
+     * Statistics that skip nulls are computed over the selected rows. Methods
+     * that do not skip nulls (MissingPolicy::Propagate) see them as missing.
+     */
+    StatisticalAnalyzer where(const Selection& rows) const;
+
+    /**
+     * @brief Analyzer over the rows matching a filter
+     * @see where(const Selection&), Filter::evaluate
+     */
+    StatisticalAnalyzer where(const Filter& filter) const;
+
+    /**
+     * @brief Groups the rows of the dataset by one or more key columns
+     * @param keys Key columns
+     * @return GroupBy sharing the dataset and running on the analyzer's threads
+     * @throws std::runtime_error if a key column doesn't exist
+     * @see GroupBy::agg
+     */
+    GroupBy groupBy(const std::vector<std::string>& keys) const;
     
     /**
      * @brief Computes the correlation matrix for specified columns
      * @param columnNames Vector of column names to include in correlation analysis
+     * @param upperTriangleOnly If true, only the upper triangle (diagonal included)
+     *        is filled and the strict lower triangle is left at zero
+     * @param missing Treatment of null values (default: pairwise complete)
      * @return Eigen::MatrixXd containing the correlation coefficients
-     * @throws std::invalid_argument if any column doesn't exist or contains non-numeric data
+     * @throws std::runtime_error if any column doesn't exist or there are fewer than two rows
+     * @throws std::invalid_argument if any column contains non-numeric data
+     * 
+     * Rows are streamed in blocks converted directly from the column buffers and
+     * folded into per-thread accumulators with symmetric rank-k updates, so
+     * neither a dense copy of the data nor a centered copy is materialized:
+     * memory is O(threads * k^2) on top of the dataset.
+     * 
+     * With MissingPolicy::PairwiseComplete and nulls present, the coefficient of
+     * each pair is computed over the rows where both columns are valid, in the
+     * same single pass: blocks carry 0/1 masks built from the validity bitmaps
+     * and the masked co-moments are matrix products of values and masks. Pairs
+     * with fewer than two complete rows get NaN.
+     * 
+     * Sums over complete stripes of rows are cached, so after rows are appended
+     * only the new rows are read again. The pairwise-complete sums are shifted
+     * by the column means at the first query and keep that shift afterwards,
+     * so they may differ from a fresh analyzer in the last digits.
      */
-    Eigen::MatrixXd correlationMatrix(const std::vector<std::string>& columnNames) const;
+    Eigen::MatrixXd correlationMatrix(const std::vector<std::string>& columnNames,
+                                      bool upperTriangleOnly = false,
+                                      MissingPolicy missing = MissingPolicy::PairwiseComplete) const;
+
+    /**
+     * @brief Computes Spearman's rank correlation matrix for specified columns
+     * @param columnNames Vector of column names to include in correlation analysis
+     * @param upperTriangleOnly If true, only the upper triangle (diagonal included)
+     *        is filled and the strict lower triangle is left at zero
+     * @return Eigen::MatrixXd containing the coefficients
+     * @throws std::runtime_error if any column doesn't exist or fewer than two rows are complete
+     * @throws std::invalid_argument if any column contains non-numeric data
+     * 
+     * Rows with a null in any of the columns are dropped (listwise deletion).
+     * Each column is ranked once (ties get average ranks) and the pairs are
+     * evaluated in parallel as Pearson correlations of the ranks.
+     */
+    Eigen::MatrixXd spearmanCorrelationMatrix(const std::vector<std::string>& columnNames,
+                                              bool upperTriangleOnly = false) const;
+
+    /**
+     * @brief Computes the Kendall tau-b correlation matrix for specified columns
+     * @param columnNames Vector of column names to include in correlation analysis
+     * @param upperTriangleOnly If true, only the upper triangle (diagonal included)
+     *        is filled and the strict lower triangle is left at zero
+     * @return Eigen::MatrixXd containing the coefficients
+     * @throws std::runtime_error if any column doesn't exist or fewer than two rows are complete
+     * @throws std::invalid_argument if any column contains non-numeric data
+     * 
+     * Rows with a null in any of the columns are dropped (listwise deletion).
+     * Each column is ranked once; each pair then costs O(n log n) with Knight's
+     * merge-sort algorithm (see kendallTau), and pairs run in parallel.
+     */
+    Eigen::MatrixXd kendallCorrelationMatrix(const std::vector<std::string>& columnNames,
+                                             bool upperTriangleOnly = false) const;
+
+    /**
+     * @brief Fits a linear model response ~ predictors by least squares
+     * @param response Numeric column to explain
+     * @param predictors Numeric columns explaining it
+     * @param ridge Penalty on the squared norm of the coefficients (0 for OLS)
+     * @param intercept Whether to fit an intercept
+     * @return Coefficients in the order of predictors, standard errors and R^2
+     * @throws std::invalid_argument if no predictor is given, a column is not
+     *         numeric or ridge is negative
+     * @throws std::runtime_error if a column doesn't exist, there are not more
+     *         complete rows than parameters, or the predictors are collinear
+     * 
+     * Uses the rows where the response and every predictor are present. The
+     * centered X^T X and X^T y are accumulated in the same blocked, parallel,
+     * cached pass as correlationMatrix, without materializing a design matrix,
+     * and the small normal equations are solved by LinearRegression::fit.
+     * @see LinearRegression for data that does not fit in a Dataset
+     */
+    RegressionResult regression(const std::string& response, const std::vector<std::string>& predictors,
+                                double ridge = 0.0, bool intercept = true) const;
 
     /**
      * @brief Reports pairs of columns with correlation coefficients exceeding the threshold
@@ -97,7 +433,15 @@ public:
                                 double threshold = 0.7,
                                 std::ostream& outStream = std::cout) const;
 private:
+    struct Cache;
+
+    /// Co-moments of numeric columns over every row, or over complete rows only (listwise)
+    CoMoments coMoments(const std::vector<std::string>& columnNames, bool listwise) const;
+
     std::shared_ptr<Dataset> dataset;
+    std::shared_ptr<const Selection> selection; ///< Rows kept by where(), null for every row
+    std::shared_ptr<Cache> cache;               ///< Partial results of complete chunks, by column
+    unsigned threadCount = 1;
 };
 
 } // namespace ScientificToolbox::Statistics
@@ -3,8 +3,25 @@
 
 
 #include "Utils.hpp"
+#include "Buffer.hpp"
+#include "StringPool.hpp"
+#include "Column.hpp"
+#include "Selection.hpp"
 #include "Dataset.hpp"
 #include "Statistical_analyzer.hpp"
+#include "Accumulators.hpp"
+#include "Quantiles.hpp"
+#include "QuantileSketch.hpp"
+#include "Streaming_analyzer.hpp"
+#include "Kernels.hpp"
+#include "Parallel.hpp"
+#include "RankCorrelation.hpp"
+#include "FrequencyTable.hpp"
+#include "GroupBy.hpp"
+#include "Filter.hpp"
+#include "Histogram.hpp"
+#include "CardinalitySketch.hpp"
+#include "Regression.hpp"
 #include "../Utilities.hpp"
 
 #endif // STATISTICS_HPP
\ No newline at end of file
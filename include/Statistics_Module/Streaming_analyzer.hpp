@@ -0,0 +1,147 @@
+#ifndef STREAMING_ANALYZER_HPP
+#define STREAMING_ANALYZER_HPP
+
+#include "Dataset.hpp"
+#include "Accumulators.hpp"
+#include "QuantileSketch.hpp"
+#include "CardinalitySketch.hpp"
+#include "Regression.hpp"
+#include <Eigen/Dense>
+#include <iostream>
+
+namespace ScientificToolbox::Statistics {
+/**
+ * @brief Out-of-core statistical analysis over row batches
+ * 
+ * Unlike StatisticalAnalyzer, which needs a fully materialized Dataset, the
+ * StreamingAnalyzer consumes data one batch at a time and keeps only running
+ * accumulators, so its memory use does not depend on the number of rows.
+ * In a single pass it tracks, for every selected numeric column:
+ * - count, mean and variance (Welford)
+ * - minimum and maximum
+ * - a quantile sketch for approximate median and quantiles
+ * - a cardinality sketch for the approximate number of distinct values
+ * and the co-moments of all selected columns for the correlation matrix and
+ * linear regressions between them.
+ * 
+ * Per-column statistics skip the nulls of that column only (a stored NaN is
+ * a value and propagates); co-moments use the rows where all selected
+ * columns are present and not NaN.
+ * 
+ * Usage example:
+ * @code
+ * StreamingAnalyzer stream({"Calories", "Protein"});
+ * stream.processCSV("data/Food_and_Nutrition__.csv");
+ * double m = stream.mean("Calories");
+ * Eigen::MatrixXd corr = stream.correlationMatrix();
+ * @endcode
+ * 
+ * @see StatisticalAnalyzer
+ */
+class StreamingAnalyzer {
+public:
+    /**
+     * @brief Constructs a StreamingAnalyzer over the given columns
+     * @param columnNames Columns to track; if empty, every numeric column of
+     *        the first batch is tracked
+     */
+    explicit StreamingAnalyzer(std::vector<std::string> columnNames = {});
+
+    /**
+     * @brief Folds a batch of rows into the accumulators
+     * @param batch Rows to add; must contain all tracked columns
+     * @throws std::runtime_error if a tracked column is missing or not numeric
+     */
+    void consume(const Dataset& batch);
+
+    /**
+     * @brief Streams a whole CSV file through the accumulators
+     * @param filename Path of the CSV file
+     * @param batchRows Number of rows held in memory at a time
+     */
+    void processCSV(const std::string& filename, size_t batchRows = 65536);
+
+    /// Names of the tracked columns, in the order of the correlation matrix
+    const std::vector<std::string>& columns() const { return columnNames; }
+
+    /// Number of rows consumed so far
+    size_t rows() const { return rowCount; }
+
+    /**
+     * @brief Returns the running statistics of a tracked column
+     * @throws std::invalid_argument if the column is not tracked
+     */
+    const RunningStats& stats(const std::string& columnName) const;
+
+    size_t count(const std::string& columnName) const { return stats(columnName).count(); }
+    double mean(const std::string& columnName) const { return stats(columnName).mean(); }
+    double variance(const std::string& columnName) const { return stats(columnName).variance(); }
+    double standardDeviation(const std::string& columnName) const { return stats(columnName).standardDeviation(); }
+    double min(const std::string& columnName) const { return stats(columnName).min(); }
+    double max(const std::string& columnName) const { return stats(columnName).max(); }
+
+    /**
+     * @brief Returns the quantile sketch of a tracked column
+     * @throws std::invalid_argument if the column is not tracked
+     */
+    const QuantileSketch& sketch(const std::string& columnName) const;
+
+    double approxQuantile(const std::string& columnName, double probability) const {
+        return sketch(columnName).quantile(probability);
+    }
+    double approxMedian(const std::string& columnName) const { return approxQuantile(columnName, 0.5); }
+
+    /**
+     * @brief Returns the distinct-count sketch of a tracked column
+     * @throws std::invalid_argument if the column is not tracked
+     */
+    const CardinalitySketch& distinctSketch(const std::string& columnName) const;
+
+    uint64_t approxDistinctCount(const std::string& columnName) const {
+        return distinctSketch(columnName).estimate();
+    }
+
+    /**
+     * @brief Pearson correlation matrix of the tracked columns
+     * @throws std::runtime_error if fewer than two complete rows were consumed
+     */
+    Eigen::MatrixXd correlationMatrix() const;
+
+    /**
+     * @brief Least-squares linear model response ~ predictors over the tracked columns
+     * @param response Tracked column to explain
+     * @param predictors Tracked columns explaining it
+     * @param ridge Penalty on the squared norm of the coefficients (0 for OLS)
+     * @param intercept Whether to fit an intercept
+     * @throws std::invalid_argument if a column is not tracked or no predictor is given
+     * @throws std::runtime_error if the model cannot be fitted (see LinearRegression::fit)
+     * 
+     * Solved from the co-moments already accumulated for the correlation
+     * matrix, so it uses the rows where every tracked column is present and
+     * any number of models can be fitted after a single pass.
+     */
+    RegressionResult regression(const std::string& response, const std::vector<std::string>& predictors,
+                                double ridge = 0.0, bool intercept = true) const;
+
+    /**
+     * @brief Reports pairs of tracked columns with correlation exceeding the threshold
+     * @param threshold Correlation coefficient threshold (default: 0.7)
+     * @param outStream Output stream to write the report to (default: std::cout)
+     */
+    void reportStrongCorrelations(double threshold = 0.7, std::ostream& outStream = std::cout) const;
+
+private:
+    std::vector<std::string> columnNames;
+    std::vector<RunningStats> columnStats;
+    std::vector<QuantileSketch> columnSketches;
+    std::vector<CardinalitySketch> columnDistinct;
+    CoMoments coMoments;
+    size_t rowCount = 0;
+
+    void initColumns(const Dataset& batch);
+    size_t columnIndex(const std::string& columnName) const;
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif
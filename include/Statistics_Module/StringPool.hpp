@@ -0,0 +1,78 @@
+#ifndef STRING_POOL_HPP
+#define STRING_POOL_HPP
+
+#include <vector>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Interned set of distinct strings, numbered by insertion order
+ * 
+ * Every string is stored once, in a single contiguous character arena; the
+ * pool hands out std::string_view into it. Lookups hash the string_view into a
+ * flat open-addressing table of codes, so interning a string that is already
+ * present neither copies nor allocates, and two interned strings are equal
+ * exactly when their codes are.
+ * 
+ * Views returned by operator[] are invalidated by intern() and clear().
+ */
+class StringPool {
+public:
+    /// Returned by find() for a string that is not in the pool
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    /**
+     * @brief Returns the code of a string, adding it to the pool if it is new
+     * @throws std::length_error if the pool would exceed 2^32 - 1 strings
+     */
+    uint32_t intern(std::string_view value);
+
+    /// Code of a string, or npos if it is not in the pool
+    uint32_t find(std::string_view value) const;
+
+    /// String of a code (code < size())
+    std::string_view operator[](uint32_t code) const {
+        return std::string_view(chars_.data() + offsets_[code], offsets_[code + 1] - offsets_[code]);
+    }
+
+    /// Number of distinct strings
+    size_t size() const { return hashes_.size(); }
+    bool empty() const { return hashes_.empty(); }
+
+    /// Removes all strings, keeping the allocated capacity
+    void clear();
+
+    /**
+     * @brief Rebuilds a pool from the layout exposed by chars() and offsets()
+     * @param chars Concatenated strings
+     * @param offsets count + 1 increasing offsets into chars, starting at 0
+     * @param count Number of strings
+     * @throws std::invalid_argument if the offsets do not fit chars or repeat a string
+     */
+    static StringPool fromArena(std::string_view chars, const uint64_t* offsets, size_t count);
+
+    /// All strings concatenated in code order
+    std::string_view chars() const { return std::string_view(chars_.data(), chars_.size()); }
+
+    /// size() + 1 offsets into chars(): string c spans [offsets()[c], offsets()[c + 1])
+    const uint64_t* offsets() const { return offsets_.data(); }
+
+    /// Approximate heap memory used by the pool, in bytes
+    size_t memoryUsage() const;
+
+private:
+    size_t slotOf(std::string_view value, uint32_t hash) const;
+    void grow();
+
+    std::vector<char> chars_;
+    std::vector<uint64_t> offsets_{0};  ///< String c is chars_[offsets_[c], offsets_[c + 1])
+    std::vector<uint32_t> hashes_;      ///< Hash of every string, to rehash and reject fast
+    std::vector<uint32_t> slots_;       ///< Code + 1 per slot, 0 for an empty slot
+};
+
+} // namespace ScientificToolbox::Statistics
+
+#endif // STRING_POOL_HPP
@@ -13,6 +13,21 @@
 #include <iostream>
 #include <functional>
 #include <chrono>
+#include <string_view>
+#include <charconv>
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include <exception>
+
+#if defined(_WIN32)
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 const inline bool DEBUG = false;
 using DataValue = std::variant<int, double, std::string>;
@@ -44,6 +59,150 @@ std::pair<double, T> measure_execution_time_py(std::function<T()> callback) {
     return measure_execution_time<T>(callback);
 }
 
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file
+ * 
+ * RAII wrapper around mmap: the file is mapped on construction and unmapped on
+ * destruction, so the contents can be tokenized in place through string_views
+ * without copying them into user-space buffers. On platforms without mmap the
+ * file is read into an owned buffer instead.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps a file in memory
+     * @param filename Path of the file to map
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& filename) {
+#if defined(_WIN32)
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not stat file: " + filename);
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Could not map file: " + filename);
+            }
+            ::madvise(addr, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(addr);
+        }
+        ::close(fd);
+#endif
+    }
+
+    ~MappedFile() {
+#if !defined(_WIN32)
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return std::string_view(data_ ? data_ : "", size_); }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    std::string buffer_;
+#endif
+};
+
+/**
+ * @brief Type a CSV column is parsed as
+ * 
+ * - Auto:   every cell is classified on its own (int, then double, then string)
+ * - Int:    cells are parsed as int
+ * - Double: cells are parsed as double, integers included
+ * - String: cells are kept as text, even if they look numeric
+ */
+enum class FieldType { Auto, Int, Double, String };
+
+/**
+ * @brief Start of the number in a cell for std::from_chars, which rejects a leading '+'
+ * 
+ * The '+' is skipped only before a digit or '.', so that "+-5" or "++5" stay
+ * non-numeric, as they were with std::stoi / std::stod.
+ */
+inline const char* skipPlusSign(const char* first, const char* last) {
+    if (last - first > 1 && *first == '+' &&
+        (std::isdigit(static_cast<unsigned char>(first[1])) || first[1] == '.')) {
+        ++first;
+    }
+    return first;
+}
+
+/**
+ * @brief Cleaned cells of one CSV record, as seen by an import row predicate
+ * 
+ * Cells are indexed like the imported columns (ImportOptions::columns, or all
+ * header columns when no projection is given). Views are only valid during
+ * the predicate call.
+ */
+class RecordView {
+public:
+    explicit RecordView(const std::vector<std::string_view>& cells) : cells_(cells) {}
+
+    size_t size() const { return cells_.size(); }
+
+    /// Text of a cell, trimmed and unquoted (empty for a missing cell)
+    std::string_view text(size_t i) const { return cells_[i]; }
+
+    bool isNull(size_t i) const { return cells_[i].empty(); }
+
+    /// Numeric value of a cell, or std::nullopt if it is empty or not a number
+    std::optional<double> number(size_t i) const {
+        const char* last = cells_[i].data() + cells_[i].size();
+        const char* first = skipPlusSign(cells_[i].data(), last);
+        double value = 0.0;
+        auto [ptr, ec] = std::from_chars(first, last, value);
+        if (first == last || ec != std::errc() || ptr != last) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+private:
+    const std::vector<std::string_view>& cells_;
+};
+
+/**
+ * @brief Options of the memory-mapped CSV import
+ */
+struct ImportOptions {
+    /// Number of leading records sampled to infer the column types (0 keeps every column Auto)
+    size_t sampleRows = 1000;
+    /// Types forced by column name, taking precedence over the inferred ones
+    std::unordered_map<std::string, FieldType> types;
+    /// Columns to import, in output order (empty imports every header column)
+    std::vector<std::string> columns;
+    /// Keeps only the records for which it returns true (empty keeps every record)
+    std::function<bool(const RecordView&)> predicate;
+};
+
 /**
  * @brief 
  * 
@@ -60,6 +219,13 @@ std::pair<double, T> measure_execution_time_py(std::function<T()> callback) {
  * - Handle null/empty values
  * - Store data in a standardized internal format
  * - Provide safe data access methods
+ * - Memory-mapped import mode that tokenizes in place and can feed typed
+ *   column buffers directly through a sink, without building row maps
+ * - Multi-threaded import splitting the file at quote-aware record boundaries
+ * - Schema inference: the mapped modes sample the first records to fix one
+ *   type per column, then parse each column with a specialized parser
+ * - Column projection and row filtering in the mapped modes: fields of
+ *   columns that are not imported are only delimited, never cleaned or parsed
  * 
  * @see OptionalDataValue
  */
@@ -67,6 +233,32 @@ std::pair<double, T> measure_execution_time_py(std::function<T()> callback) {
 class Importer {
 public: 
 
+    Importer() = default;
+    explicit Importer(ImportOptions options) : options_(std::move(options)) {}
+
+    /**
+     * @brief Column types used by the last mapped import, in imported column order
+     * 
+     * Filled after the header is parsed: inferred from the sampled records
+     * (Auto for columns whose sampled cells are all empty), then overridden
+     * by ImportOptions::types.
+     */
+    const std::vector<FieldType>& getColumnTypes() const {
+        return types_;
+    }
+
+    /**
+     * @brief Reads only the header record of a CSV file
+     * @param filename The path to the CSV file
+     * @return Column names in file order
+     * @throws std::runtime_error if the file cannot be opened or has no header
+     */
+    std::vector<std::string> readHeader(const std::string& filename) {
+        MappedFile file(filename);
+        parseHeaderRecord(file.view());
+        return headers_;
+    }
+
     /**
      *  import
      * @brief Main method to import data from a CSV file
@@ -91,6 +283,138 @@ public:
         }
     }
 
+    /**
+     *  importMapped
+     * @brief Imports a CSV file through a memory mapping, filling getData()
+     * @param filename The path to the CSV file to be imported
+     * @throws std::runtime_error if the file cannot be opened or has no header
+     * 
+     * Produces the same row structure as import(), but tokenizes the mapped
+     * buffer in place and parses numbers without exceptions.
+     */
+    void importMapped(const std::string& filename) {
+        data_.clear();
+        RowSink sink{*this, {}};
+        importMapped(filename, sink);
+    }
+
+    /**
+     *  importMapped
+     * @brief Imports a CSV file through a memory mapping, streaming every cell to a sink
+     * @tparam Sink Receiver of the parsed cells, providing:
+     *   - header(const std::vector<std::string>& names)
+     *   - value(size_t column, int), value(size_t column, double),
+     *     value(size_t column, std::string_view)
+     *   - null(size_t column)
+     *   - endRow()
+     * @param filename The path to the CSV file to be imported
+     * @param sink The receiver of the parsed header and cells
+     * @throws std::runtime_error if the file cannot be opened or has no header
+     * 
+     * Fields are located with string_views over the mapped file, so only cells
+     * that need unescaping ("" inside quotes) are copied. The first
+     * ImportOptions::sampleRows records fix the type of every column (see
+     * getColumnTypes()) and each cell is then parsed with the std::from_chars
+     * parser of its column type; a cell that does not fit that type falls back
+     * to the per-cell classification. Every data row emits exactly one call per
+     * imported column (missing trailing cells are reported as nulls) followed by
+     * endRow(). With ImportOptions::columns, the sink sees only those columns,
+     * numbered in projection order; records rejected by ImportOptions::predicate
+     * are skipped.
+     * String views passed to the sink are only valid during the call.
+     */
+    template <typename Sink>
+    void importMapped(const std::string& filename, Sink& sink) {
+        MappedFile file(filename);
+        std::string_view buffer = file.view();
+        const char* p = parseHeaderRecord(buffer);
+        resolveProjection();
+        inferTypes(p, buffer.data() + buffer.size());
+        sink.header(columns_);
+        parseRecords(p, buffer.data() + buffer.size(), sink);
+    }
+
+    /**
+     *  importParallel
+     * @brief Imports a CSV file through a memory mapping, parsing byte ranges on several threads
+     * @tparam Sink Same requirements as for importMapped
+     * @param filename The path to the CSV file to be imported
+     * @param sinks One sink per chunk; sinks.size() is the number of threads used
+     * @throws std::runtime_error if the file cannot be opened or has no header;
+     *         exceptions thrown by a sink are rethrown after all threads joined
+     * 
+     * The body of the file is cut into sinks.size() byte ranges of equal size.
+     * Each split point is moved forward to the next record boundary: a first
+     * parallel pass counts the quotes of every range, so the inside_quotes state
+     * at each split point is known from the parity of all quotes before it, and
+     * a newline only ends a record if it is outside quotes. Every sink receives
+     * header() and then the rows of its own range in file order, so the rows of
+     * sinks[k] precede those of sinks[k + 1] and concatenating the sinks in
+     * order restores the original row order.
+     */
+    template <typename Sink>
+    void importParallel(const std::string& filename, std::vector<Sink>& sinks) {
+        if (sinks.empty()) {
+            throw std::invalid_argument("importParallel needs at least one sink");
+        }
+        MappedFile file(filename);
+        std::string_view buffer = file.view();
+        const char* body = parseHeaderRecord(buffer);
+        const char* end = buffer.data() + buffer.size();
+        resolveProjection();
+        inferTypes(body, end);
+
+        const size_t chunks = sinks.size();
+        const size_t length = static_cast<size_t>(end - body);
+        std::vector<const char*> bounds(chunks + 1);
+        for (size_t k = 0; k <= chunks; ++k) {
+            bounds[k] = body + length * k / chunks;
+        }
+
+        // Pass 1: quote parity of every range
+        std::vector<char> parity(chunks, 0);
+        runChunks(chunks, [&](size_t k) {
+            size_t quotes = std::count(bounds[k], bounds[k + 1], '"');
+            parity[k] = static_cast<char>(quotes & 1);
+        });
+
+        // Move each split point to the first record boundary at or after it
+        std::vector<const char*> starts(chunks + 1);
+        starts[0] = body;
+        starts[chunks] = end;
+        bool inside_quotes = false;
+        for (size_t k = 1; k < chunks; ++k) {
+            inside_quotes ^= parity[k - 1] != 0;
+            const char* p = std::max(bounds[k], starts[k - 1]);
+            bool state = inside_quotes;
+            // If the previous range was already extended past bounds[k], the
+            // record boundary it ended on is a valid start as well
+            if (p != bounds[k]) {
+                starts[k] = p;
+                continue;
+            }
+            if (p > body && p[-1] == '\n' && !state) {
+                starts[k] = p;
+                continue;
+            }
+            while (p < end) {
+                char ch = *p++;
+                if (ch == '"') {
+                    state = !state;
+                } else if (ch == '\n' && !state) {
+                    break;
+                }
+            }
+            starts[k] = p;
+        }
+
+        // Pass 2: parse every range into its own sink
+        runChunks(chunks, [&](size_t k) {
+            sinks[k].header(columns_);
+            parseRecords(starts[k], std::max(starts[k], starts[k + 1]), sinks[k]);
+        });
+    }
+
     /**
      * @brief Retrieves the stored data from the object
      * 
@@ -104,6 +428,359 @@ public:
 private:
     std::vector<std::unordered_map<std::string, OptionalDataValue>> data_;
     std::vector<std::string> headers_;
+    std::vector<std::string> columns_;  ///< Imported column names, in output order
+    std::vector<size_t> selected_;      ///< Header index of every imported column
+    std::vector<FieldType> types_;
+    ImportOptions options_;
+
+    /**
+     * @brief Sink used by importMapped(filename) to rebuild the row-wise data_ layout
+     */
+    struct RowSink {
+        Importer& importer;
+        std::unordered_map<std::string, OptionalDataValue> row;
+
+        void header(const std::vector<std::string>&) {}
+        void value(size_t col, int v) { row[importer.columns_[col]] = DataValue(v); }
+        void value(size_t col, double v) { row[importer.columns_[col]] = DataValue(v); }
+        void value(size_t col, std::string_view v) { row[importer.columns_[col]] = DataValue(std::string(v)); }
+        void null(size_t col) { row[importer.columns_[col]] = std::nullopt; }
+        void endRow() {
+            importer.data_.push_back(std::move(row));
+            row.clear();
+        }
+    };
+
+    /**
+     * @brief Parses the header record of a mapped CSV buffer into headers_
+     * @param buffer Whole file contents
+     * @return Pointer to the first character after the header record
+     * @throws std::runtime_error if no header is found
+     */
+    const char* parseHeaderRecord(std::string_view buffer) {
+        // Skip the UTF-8 byte order mark if present
+        if (buffer.size() >= 3 && buffer.substr(0, 3) == "\xEF\xBB\xBF") {
+            buffer.remove_prefix(3);
+        }
+
+        std::vector<std::string_view> fields;
+        std::string scratch;
+        const char* p = splitRecord(buffer.data(), buffer.data() + buffer.size(), fields);
+        if (fields.size() == 1 && cleanField(fields[0], scratch).empty()) {
+            throw std::runtime_error("No headers found in the CSV file.");
+        }
+        headers_.clear();
+        for (size_t i = 0; i < fields.size(); ++i) {
+            std::string_view name = cleanField(fields[i], scratch);
+            if (name.empty()) {
+                std::cerr << "Warning: Empty header found" << std::endl;
+                headers_.push_back("column_" + std::to_string(i));
+            } else {
+                headers_.emplace_back(name);
+            }
+        }
+        return p;
+    }
+
+    /**
+     * @brief Parses all data records in [p, end) and streams them to a sink
+     * 
+     * Only the fields of the imported columns are cleaned and parsed; the
+     * others are delimited by splitRecord and then ignored.
+     */
+    template <typename Sink>
+    void parseRecords(const char* p, const char* end, Sink& sink) const {
+        std::vector<std::string_view> fields;
+        std::vector<std::string_view> cells(selected_.size());
+        std::vector<std::string> scratch(selected_.size());
+        std::string blank;
+        const size_t ncols = headers_.size();
+        while (p < end) {
+            p = splitRecord(p, end, fields);
+            // Skip blank lines
+            if (fields.size() == 1 && cleanField(fields[0], blank).empty()) {
+                continue;
+            }
+            if (fields.size() > ncols) {
+                std::cerr << "Warning: More cells than headers in line" << std::endl;
+            }
+            for (size_t k = 0; k < selected_.size(); ++k) {
+                const size_t i = selected_[k];
+                cells[k] = i < fields.size() ? cleanField(fields[i], scratch[k]) : std::string_view();
+            }
+            if (options_.predicate && !options_.predicate(RecordView(cells))) {
+                continue;
+            }
+            for (size_t k = 0; k < selected_.size(); ++k) {
+                emitTypedCell(sink, k, cells[k], types_[k]);
+            }
+            sink.endRow();
+        }
+    }
+
+    /**
+     * @brief Maps ImportOptions::columns to header indices (all columns if empty)
+     * @throws std::invalid_argument if a projected column is unknown or repeated
+     */
+    void resolveProjection() {
+        selected_.clear();
+        columns_.clear();
+        if (options_.columns.empty()) {
+            columns_ = headers_;
+            for (size_t i = 0; i < headers_.size(); ++i) {
+                selected_.push_back(i);
+            }
+            return;
+        }
+        for (const auto& name : options_.columns) {
+            auto it = std::find(headers_.begin(), headers_.end(), name);
+            if (it == headers_.end()) {
+                throw std::invalid_argument("Unknown column in projection: " + name);
+            }
+            if (std::find(columns_.begin(), columns_.end(), name) != columns_.end()) {
+                throw std::invalid_argument("Column projected twice: " + name);
+            }
+            selected_.push_back(static_cast<size_t>(it - headers_.begin()));
+            columns_.push_back(name);
+        }
+    }
+
+    /**
+     * @brief Runs task(k) for k in [0, chunks) on one thread per chunk
+     * 
+     * The first exception thrown by any task is rethrown once all threads joined.
+     */
+    template <typename Task>
+    static void runChunks(size_t chunks, Task&& task) {
+        std::vector<std::exception_ptr> errors(chunks);
+        std::vector<std::thread> workers;
+        workers.reserve(chunks);
+        for (size_t k = 0; k < chunks; ++k) {
+            workers.emplace_back([&, k]() {
+                try {
+                    task(k);
+                } catch (...) {
+                    errors[k] = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Splits one CSV record into raw fields, honouring quotes
+     * @param p Start of the record
+     * @param end End of the buffer
+     * @param fields Output: views over the raw (untrimmed, still quoted) fields
+     * @return Pointer to the first character of the next record
+     * 
+     * Commas and newlines inside quoted fields do not split, so a quoted field
+     * may span several lines.
+     */
+    static const char* splitRecord(const char* p, const char* end, std::vector<std::string_view>& fields) {
+        fields.clear();
+        const char* start = p;
+        bool inside_quotes = false;
+        for (; p < end; ++p) {
+            char ch = *p;
+            if (ch == '"') {
+                inside_quotes = !inside_quotes;
+            } else if (!inside_quotes) {
+                if (ch == ',') {
+                    fields.emplace_back(start, static_cast<size_t>(p - start));
+                    start = p + 1;
+                } else if (ch == '\n') {
+                    fields.emplace_back(start, static_cast<size_t>(p - start));
+                    return p + 1;
+                }
+            }
+        }
+        fields.emplace_back(start, static_cast<size_t>(p - start));
+        return p;
+    }
+
+    /**
+     * @brief Trims whitespace and enclosing quotes from a raw field
+     * @param field Raw field as returned by splitRecord
+     * @param scratch Buffer used when escaped quotes ("") must be collapsed
+     * @return View over the cleaned field (into the mapped buffer or into scratch)
+     */
+    static std::string_view cleanField(std::string_view field, std::string& scratch) {
+        size_t start = 0;
+        while (start < field.size() && std::isspace(static_cast<unsigned char>(field[start]))) {
+            ++start;
+        }
+        size_t end = field.size();
+        while (end > start && std::isspace(static_cast<unsigned char>(field[end - 1]))) {
+            --end;
+        }
+        if (end - start >= 2 && field[start] == '"' && field[end - 1] == '"') {
+            ++start;
+            --end;
+        }
+        field = field.substr(start, end - start);
+        if (field.find('"') == std::string_view::npos) {
+            return field;
+        }
+
+        scratch.clear();
+        for (size_t i = 0; i < field.size(); ++i) {
+            if (field[i] == '"' && i + 1 < field.size() && field[i + 1] == '"') {
+                ++i;
+            }
+            scratch.push_back(field[i]);
+        }
+        return scratch;
+    }
+
+    /**
+     * @brief Parses a whole cell as an int with std::from_chars (a leading '+' is allowed before a digit)
+     * @return false if the cell is not an int or does not fit in one
+     */
+    static bool parseInt(std::string_view cell, int& value) {
+        const char* last = cell.data() + cell.size();
+        const char* first = skipPlusSign(cell.data(), last);
+        auto [ptr, ec] = std::from_chars(first, last, value);
+        return ec == std::errc() && ptr == last;
+    }
+
+    /**
+     * @brief Parses a whole cell as a double with std::from_chars (a leading '+' is allowed before a digit)
+     * @return false if the cell is not a number
+     */
+    static bool parseDouble(std::string_view cell, double& value) {
+        const char* last = cell.data() + cell.size();
+        const char* first = skipPlusSign(cell.data(), last);
+        auto [ptr, ec] = std::from_chars(first, last, value);
+        return ec == std::errc() && ptr == last;
+    }
+
+    /**
+     * @brief Classifies a non-empty cleaned cell the way emitCell does
+     */
+    static FieldType classify(std::string_view cell) {
+        int int_value = 0;
+        double double_value = 0.0;
+        if (cell.find(',') != std::string_view::npos) {
+            return FieldType::String;
+        }
+        if (parseInt(cell, int_value)) {
+            return FieldType::Int;
+        }
+        return parseDouble(cell, double_value) ? FieldType::Double : FieldType::String;
+    }
+
+    /**
+     * @brief Fixes types_ from the first sampled records of [p, end) and the user overrides
+     * @throws std::invalid_argument if an override names a column that is not in the header
+     * 
+     * A column is Int if all its sampled non-empty cells are ints, Double if
+     * they are all numbers, String as soon as one of them is not a number, and
+     * Auto if they are all empty.
+     */
+    void inferTypes(const char* p, const char* end) {
+        types_.assign(selected_.size(), FieldType::Auto);
+        std::vector<std::string_view> fields;
+        std::string scratch;
+        for (size_t sampled = 0; sampled < options_.sampleRows && p < end;) {
+            p = splitRecord(p, end, fields);
+            if (fields.size() == 1 && cleanField(fields[0], scratch).empty()) {
+                continue;
+            }
+            for (size_t k = 0; k < selected_.size(); ++k) {
+                if (selected_[k] >= fields.size() || types_[k] == FieldType::String) {
+                    continue;
+                }
+                std::string_view cell = cleanField(fields[selected_[k]], scratch);
+                if (!cell.empty()) {
+                    // Auto < Int < Double < String: a column takes the widest type seen
+                    types_[k] = std::max(types_[k], classify(cell));
+                }
+            }
+            ++sampled;
+        }
+        for (const auto& [name, type] : options_.types) {
+            if (std::find(headers_.begin(), headers_.end(), name) == headers_.end()) {
+                throw std::invalid_argument("Type override for unknown column: " + name);
+            }
+            auto it = std::find(columns_.begin(), columns_.end(), name);
+            if (it != columns_.end()) {
+                types_[static_cast<size_t>(it - columns_.begin())] = type;
+            }
+        }
+    }
+
+    /**
+     * @brief Parses a cleaned cell with the parser of its column type
+     * 
+     * Cells that the column parser rejects (e.g. text in an Int column) fall
+     * back to emitCell, so the sink sees the same values as without inference.
+     */
+    template <typename Sink>
+    static void emitTypedCell(Sink& sink, size_t col, std::string_view cell, FieldType type) {
+        if (cell.empty()) {
+            sink.null(col);
+            return;
+        }
+        switch (type) {
+            case FieldType::Int: {
+                int value = 0;
+                if (parseInt(cell, value)) {
+                    sink.value(col, value);
+                    return;
+                }
+                break;
+            }
+            case FieldType::Double: {
+                double value = 0.0;
+                if (parseDouble(cell, value)) {
+                    sink.value(col, value);
+                    return;
+                }
+                break;
+            }
+            case FieldType::String:
+                sink.value(col, cell);
+                return;
+            case FieldType::Auto:
+                break;
+        }
+        emitCell(sink, col, cell);
+    }
+
+    /**
+     * @brief Parses a cleaned cell and forwards it to the sink with its type
+     * 
+     * Same classification as parseValue (int, then double, then string), but
+     * using std::from_chars so no exception is thrown for non-numeric cells.
+     */
+    template <typename Sink>
+    static void emitCell(Sink& sink, size_t col, std::string_view cell) {
+        if (cell.empty()) {
+            sink.null(col);
+            return;
+        }
+        if (cell.find(',') == std::string_view::npos) {
+            int int_value = 0;
+            if (parseInt(cell, int_value)) {
+                sink.value(col, int_value);
+                return;
+            }
+            double double_value = 0.0;
+            if (parseDouble(cell, double_value)) {
+                sink.value(col, double_value);
+                return;
+            }
+        }
+        sink.value(col, cell);
+    }
 
     /**
      *  parseHeader
@@ -246,7 +923,8 @@ private:
      * Tries to convert the input string to:
      * 1. Integer
      * 2. Double 
-     * If both conversions fail, returns the original string
+     * If both conversions fail, returns the original string.
+     * Uses std::from_chars, so non-numeric cells do not throw.
      */
     OptionalDataValue parseValue(const std::string& cell) {
         std::string trimmed_cell = trim(cell);
@@ -256,26 +934,14 @@ private:
             return std::make_optional<DataValue>(trimmed_cell);
         }
 
-        // Try parsing as integer
-        try {
-            size_t pos = 0;
-            int int_value = std::stoi(trimmed_cell, &pos);
-            if (pos == trimmed_cell.length()) {
-                return std::make_optional<DataValue>(int_value);
-            }
-        } catch (...) {
-            // Failed to parse as integer, continue to double
+        int int_value = 0;
+        if (parseInt(trimmed_cell, int_value)) {
+            return std::make_optional<DataValue>(int_value);
         }
 
-        // Try parsing as double
-        try {
-            size_t pos = 0;
-            double double_value = std::stod(trimmed_cell, &pos);
-            if (pos == trimmed_cell.length()) {
-                return std::make_optional<DataValue>(double_value);
-            }
-        } catch (...) {
-            // Failed to parse as double, return as string
+        double double_value = 0.0;
+        if (parseDouble(trimmed_cell, double_value)) {
+            return std::make_optional<DataValue>(double_value);
         }
 
         // Return as string if all numeric conversions fail
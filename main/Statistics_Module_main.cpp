@@ -1,8 +1,10 @@
 #include "../include/Statistics_Module/Statistical_analyzer.hpp"
 #include "../include/Utilities.hpp"
 #include <iostream>
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
+#include <thread>
 
 using namespace ScientificToolbox;
 
@@ -19,44 +21,66 @@ int main() {
             inputFile = project_dir + "/data/" + userInput;
         }
 
-        Importer importer;
-        importer.import(inputFile);
-        auto rawData = importer.getData();
-        auto dataset = std::make_shared<Statistics::Dataset>(rawData);
-        Statistics::StatisticalAnalyzer analyzer(dataset);
-
         std::vector<std::string> columns;
         std::cout << "Enter column names for analysis (comma-separated, press Enter for all numeric):\n";
         std::string columnInput;
         std::getline(std::cin, columnInput);
 
-        if (columnInput.empty()) {
-            auto allColumns = dataset->getColumnNames();
-            for (const auto& col : allColumns) {
-                if (dataset->isNumericColumn(col)) {
-                    columns.push_back(col);
+        std::stringstream ss(columnInput);
+        std::string col;
+        while (std::getline(ss, col, ',')) {
+            col.erase(0, col.find_first_not_of(" "));
+            col.erase(col.find_last_not_of(" ") + 1);
+            columns.push_back(col);
+        }
+
+        // Only parse the requested columns of a CSV file; unknown names are left
+        // out of the projection and reported when their analysis fails
+        ImportOptions options;
+        if (!columns.empty() && !Statistics::Dataset::isSnapshot(inputFile)) {
+            auto header = Importer().readHeader(inputFile);
+            for (const auto& name : columns) {
+                if (std::find(header.begin(), header.end(), name) != header.end() &&
+                    std::find(options.columns.begin(), options.columns.end(), name) == options.columns.end()) {
+                    options.columns.push_back(name);
                 }
             }
-        } else {
-            std::stringstream ss(columnInput);
-            std::string col;
-            while (std::getline(ss, col, ',')) {
-                col.erase(0, col.find_first_not_of(" "));
-                col.erase(col.find_last_not_of(" ") + 1);
-                columns.push_back(col);
+        }
+
+        auto dataset = std::make_shared<Statistics::Dataset>(
+            Statistics::Dataset::load(inputFile, std::thread::hardware_concurrency(), options));
+        Statistics::StatisticalAnalyzer analyzer(dataset, std::thread::hardware_concurrency());
+
+        if (columns.empty()) {
+            auto allColumns = dataset->getColumnNames();
+            for (const auto& name : allColumns) {
+                if (dataset->isNumericColumn(name)) {
+                    columns.push_back(name);
+                }
             }
         }
 
         std::filesystem::create_directories(std::filesystem::path(outputFile).parent_path());
         std::ofstream outFile(outputFile);
 
-        for (const auto& col : columns) {
+        // Summarize all columns in one parallel pass; if one of them cannot be
+        // analyzed, fall back to per-column calls so the others are still reported
+        std::vector<Statistics::ColumnSummary> summaries;
+        try {
+            summaries = analyzer.describe(columns, {0.5});
+        } catch (const std::exception&) {
+            summaries.clear();
+        }
+
+        for (size_t i = 0; i < columns.size(); ++i) {
+            const auto& col = columns[i];
             outFile << "Statistics for " << col << ":\n";
             try {
-                outFile << "Mean: " << analyzer.mean<double>(col) << "\n";
-                outFile << "Median: " << analyzer.median<double>(col) << "\n";
-                outFile << "Variance: " << analyzer.variance<double>(col) << "\n";
-                outFile << "Standard Deviation: " << analyzer.standardDeviation<double>(col) << "\n\n";
+                auto summary = summaries.empty() ? analyzer.describe({col}, {0.5}).front() : summaries[i];
+                outFile << "Mean: " << summary.mean << "\n";
+                outFile << "Median: " << summary.quantiles[0] << "\n";
+                outFile << "Variance: " << summary.variance << "\n";
+                outFile << "Standard Deviation: " << summary.standardDeviation << "\n\n";
                 
                 if (dataset->isNumericColumn(col)) {
                     auto freqCount = analyzer.frequencyCount<double>(col);
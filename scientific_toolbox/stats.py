@@ -11,6 +11,16 @@ except ImportError:
 
 ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
 
+
+def from_dataframe(df):
+    """Builds a Dataset from the column arrays of a pandas DataFrame, without per-row dicts.
+
+    float64 and int32 columns are borrowed without copying (see Dataset.fromNumpy),
+    so the DataFrame must not be modified while the Dataset is in use.
+    """
+    return Dataset.fromNumpy({str(name): df[name].to_numpy() for name in df.columns})
+
+
 class StatisticsAnalyzer:
     def __init__(self, data_dir='../data/', output_dir='../output/'):
         self.data_dir = data_dir
@@ -114,8 +114,8 @@ setup(
                 "include/Statistics_Module",
             ],
             language='c++',
-            extra_compile_args=["-std=c++17"] + eigen_cflags,
-            extra_link_args=eigen_libs,
+            extra_compile_args=["-std=c++17", "-pthread"] + eigen_cflags,
+            extra_link_args=["-pthread"] + eigen_libs,
         ),
         Extension(
             'scientific_toolbox.utilities',
@@ -0,0 +1,109 @@
+#include "../../include/Statistics_Module/Accumulators.hpp"
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+CoMoments::CoMoments(size_t dims)
+    : mu(Eigen::VectorXd::Zero(static_cast<Eigen::Index>(dims))),
+      c(Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(dims), static_cast<Eigen::Index>(dims))) {}
+
+void CoMoments::push(const Eigen::Ref<const Eigen::VectorXd>& row) {
+    if (row.size() != mu.size()) {
+        throw std::invalid_argument("Observation size does not match the number of variables");
+    }
+    ++n;
+    Eigen::VectorXd delta = row - mu;
+    mu += delta / static_cast<double>(n);
+    // delta * (row - new mean)^T == delta * delta^T * (n - 1) / n
+    c.selfadjointView<Eigen::Upper>().rankUpdate(delta, static_cast<double>(n - 1) / static_cast<double>(n));
+}
+
+void CoMoments::pushBlock(const Eigen::Ref<const Eigen::MatrixXd>& block) {
+    if (block.cols() != mu.size()) {
+        throw std::invalid_argument("Block width does not match the number of variables");
+    }
+    if (block.rows() == 0) {
+        return;
+    }
+    // Centered rank-k update of the block, then the same pairwise correction as
+    // merge(), applied in place so no dims x dims temporary is allocated
+    const size_t rows = static_cast<size_t>(block.rows());
+    Eigen::VectorXd blockMean = block.colwise().mean().transpose();
+    Eigen::MatrixXd centered = block.rowwise() - blockMean.transpose();
+    c.selfadjointView<Eigen::Upper>().rankUpdate(centered.transpose());
+    if (n == 0) {
+        mu = blockMean;
+    } else {
+        double total = static_cast<double>(n + rows);
+        Eigen::VectorXd delta = blockMean - mu;
+        c.selfadjointView<Eigen::Upper>().rankUpdate(delta, static_cast<double>(n) * static_cast<double>(rows) / total);
+        mu += delta * (static_cast<double>(rows) / total);
+    }
+    n += rows;
+}
+
+void CoMoments::merge(const CoMoments& other) {
+    if (other.n == 0) return;
+    if (other.mu.size() != mu.size()) {
+        throw std::invalid_argument("Cannot merge co-moments over different numbers of variables");
+    }
+    if (n == 0) {
+        *this = other;
+        return;
+    }
+    double total = static_cast<double>(n + other.n);
+    Eigen::VectorXd delta = other.mu - mu;
+    double weight = static_cast<double>(n) * static_cast<double>(other.n) / total;
+    c.triangularView<Eigen::Upper>() += other.c;
+    c.selfadjointView<Eigen::Upper>().rankUpdate(delta, weight);
+    mu += delta * (static_cast<double>(other.n) / total);
+    n += other.n;
+}
+
+Eigen::MatrixXd CoMoments::comoments() const {
+    return c.selfadjointView<Eigen::Upper>();
+}
+
+CoMoments CoMoments::select(const std::vector<size_t>& variables) const {
+    const auto k = static_cast<Eigen::Index>(variables.size());
+    CoMoments out(variables.size());
+    out.n = n;
+    for (Eigen::Index a = 0; a < k; ++a) {
+        const auto i = static_cast<Eigen::Index>(variables[static_cast<size_t>(a)]);
+        if (i >= mu.size()) {
+            throw std::out_of_range("Variable index out of range");
+        }
+        out.mu(a) = mu(i);
+        for (Eigen::Index b = 0; b <= a; ++b) {
+            const auto j = static_cast<Eigen::Index>(variables[static_cast<size_t>(b)]);
+            // Only the upper triangle of c is accumulated
+            out.c(b, a) = i <= j ? c(i, j) : c(j, i);
+        }
+    }
+    return out;
+}
+
+Eigen::MatrixXd CoMoments::covariance() const {
+    if (n < 2) {
+        throw std::runtime_error("At least two observations are needed for a covariance");
+    }
+    return comoments() / static_cast<double>(n - 1);
+}
+
+Eigen::MatrixXd CoMoments::correlation(bool upperTriangleOnly) const {
+    if (n < 2) {
+        throw std::runtime_error("At least two observations are needed for a correlation");
+    }
+    // The n - 1 of the covariance cancels out: scale C by 1 / sqrt(Cii * Cjj)
+    Eigen::VectorXd inv = c.diagonal().array().sqrt().inverse();
+    Eigen::MatrixXd r = Eigen::MatrixXd::Zero(c.rows(), c.cols());
+    for (Eigen::Index j = 0; j < c.cols(); ++j) {
+        r.col(j).head(j + 1) = c.col(j).head(j + 1).cwiseProduct(inv.head(j + 1)) * inv(j);
+    }
+    if (!upperTriangleOnly) {
+        r.triangularView<Eigen::StrictlyLower>() = r.transpose();
+    }
+    return r;
+}
+
+} // namespace ScientificToolbox::Statistics
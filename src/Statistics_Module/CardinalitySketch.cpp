@@ -0,0 +1,274 @@
+#include "../../include/Statistics_Module/CardinalitySketch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+constexpr uint32_t SKETCH_MAGIC = 0x484C4C31; // "HLL1"
+
+constexpr uint8_t kMinPrecision = 4;
+constexpr uint8_t kMaxPrecision = 18;
+
+/// Seed of string hashes, so that strings and numbers do not share hashes
+constexpr uint64_t kStringSeed = 0x9E3779B97F4A7C15ULL;
+
+/// splitmix64 finalizer: spreads every input bit over the whole word
+inline uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+template <typename T>
+void writeRaw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readRaw(const std::string& in, size_t& pos) {
+    if (pos + sizeof(T) > in.size()) {
+        throw std::runtime_error("Truncated cardinality sketch");
+    }
+    T value;
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+/// sigma(x) = x + sum_k x^(2^k) 2^(k-1), the small-range correction of Ertl's estimator
+double sigma(double x) {
+    if (x == 1.0) return std::numeric_limits<double>::infinity();
+    double y = 1.0, z = x, previous;
+    do {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+/// tau(x), the large-range correction of Ertl's estimator
+double tau(double x) {
+    if (x == 0.0 || x == 1.0) return 0.0;
+    double y = 1.0, z = 1.0 - x, previous;
+    do {
+        x = std::sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
+
+} // namespace
+
+CardinalitySketch::CardinalitySketch(uint8_t precision)
+    : precision_(precision), exact_(16, 0) {
+    if (precision < kMinPrecision || precision > kMaxPrecision) {
+        throw std::invalid_argument("Cardinality sketch precision must be in [4, 18]");
+    }
+}
+
+uint64_t CardinalitySketch::hash(double value) {
+    if (std::isnan(value)) value = std::numeric_limits<double>::quiet_NaN();
+    if (value == 0.0) value = 0.0;
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return mix(bits);
+}
+
+uint64_t CardinalitySketch::hash(std::string_view value) {
+    uint64_t h = kStringSeed ^ value.size();
+    size_t i = 0;
+    for (; i + 8 <= value.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, value.data() + i, 8);
+        h = mix(h ^ word);
+    }
+    uint64_t tail = 0;
+    if (value.size() > i) {
+        std::memcpy(&tail, value.data() + i, value.size() - i);
+    }
+    return mix(h ^ tail);
+}
+
+size_t CardinalitySketch::exactLimit() const {
+    // The largest hash set (2^precision / 4 slots of 8 bytes) takes twice the registers
+    return (size_t{1} << precision_) / 8;
+}
+
+void CardinalitySketch::insertExact(uint64_t hash) {
+    // 0 marks a free slot: the hash 0 is stored as 1, one more collision in 2^64
+    hash = hash == 0 ? 1 : hash;
+    size_t mask = exact_.size() - 1;
+    size_t slot = hash & mask;
+    while (exact_[slot] != 0) {
+        if (exact_[slot] == hash) return;
+        slot = (slot + 1) & mask;
+    }
+    if (exactSize_ + 1 > exactLimit()) {
+        toDense();
+        addDense(hash);
+        return;
+    }
+    exact_[slot] = hash;
+    ++exactSize_;
+    if (2 * exactSize_ > exact_.size()) {
+        std::vector<uint64_t> old(2 * exact_.size(), 0);
+        old.swap(exact_);
+        mask = exact_.size() - 1;
+        for (uint64_t h : old) {
+            if (h == 0) continue;
+            for (slot = h & mask; exact_[slot] != 0; slot = (slot + 1) & mask) {}
+            exact_[slot] = h;
+        }
+    }
+}
+
+void CardinalitySketch::toDense() {
+    registers_.assign(size_t{1} << precision_, 0);
+    for (uint64_t h : exact_) {
+        if (h != 0) addDense(h);
+    }
+    exact_ = std::vector<uint64_t>();
+    exactSize_ = 0;
+}
+
+inline void CardinalitySketch::addDense(uint64_t hash) {
+    // The register is picked by the top bits; the bit set below the remaining
+    // ones caps the rank at 64 - precision + 1 without a branch
+    const size_t index = hash >> (64 - precision_);
+    const uint64_t rest = (hash << precision_) | (uint64_t{1} << (precision_ - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+}
+
+void CardinalitySketch::addHash(uint64_t hash) {
+    if (registers_.empty()) {
+        insertExact(hash);
+    } else {
+        addDense(hash);
+    }
+}
+
+template <typename T>
+void CardinalitySketch::add(const T* values, size_t n, const uint64_t* validity) {
+    auto valid = [validity](size_t i) { return !validity || ((validity[i >> 6] >> (i & 63)) & 1); };
+    size_t i = 0;
+    for (; i < n && registers_.empty(); ++i) {
+        if (valid(i)) insertExact(hash(static_cast<double>(values[i])));
+    }
+    for (; i < n; ++i) {
+        if (valid(i)) addDense(hash(static_cast<double>(values[i])));
+    }
+}
+
+void CardinalitySketch::merge(const CardinalitySketch& other) {
+    if (other.precision_ != precision_) {
+        throw std::invalid_argument("Cannot merge cardinality sketches with different precisions");
+    }
+    if (other.registers_.empty()) {
+        for (uint64_t h : other.exact_) {
+            if (h != 0) addHash(h);
+        }
+        return;
+    }
+    if (registers_.empty()) {
+        toDense();
+    }
+    for (size_t r = 0; r < registers_.size(); ++r) {
+        registers_[r] = std::max(registers_[r], other.registers_[r]);
+    }
+}
+
+uint64_t CardinalitySketch::estimate() const {
+    if (registers_.empty()) {
+        return exactSize_;
+    }
+    const size_t q = 64 - precision_;
+    const double m = static_cast<double>(registers_.size());
+    std::vector<uint64_t> histogram(q + 2, 0);
+    for (uint8_t r : registers_) {
+        ++histogram[r];
+    }
+    double z = m * tau(1.0 - static_cast<double>(histogram[q + 1]) / m);
+    for (size_t k = q; k >= 1; --k) {
+        z = 0.5 * (z + static_cast<double>(histogram[k]));
+    }
+    z += m * sigma(static_cast<double>(histogram[0]) / m);
+    return static_cast<uint64_t>(std::llround(0.5 / std::log(2.0) * m * m / z));
+}
+
+double CardinalitySketch::standardError() const {
+    return 1.04 / std::sqrt(static_cast<double>(size_t{1} << precision_));
+}
+
+std::string CardinalitySketch::serialize() const {
+    std::string out;
+    writeRaw(out, SKETCH_MAGIC);
+    writeRaw(out, precision_);
+    writeRaw(out, static_cast<uint8_t>(registers_.empty() ? 0 : 1));
+    if (registers_.empty()) {
+        // Sorted, so that equal sketches serialize to equal bytes
+        std::vector<uint64_t> hashes;
+        hashes.reserve(exactSize_);
+        for (uint64_t h : exact_) {
+            if (h != 0) hashes.push_back(h);
+        }
+        std::sort(hashes.begin(), hashes.end());
+        writeRaw(out, static_cast<uint32_t>(hashes.size()));
+        out.append(reinterpret_cast<const char*>(hashes.data()), hashes.size() * sizeof(uint64_t));
+    } else {
+        out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+    }
+    return out;
+}
+
+CardinalitySketch CardinalitySketch::deserialize(const std::string& bytes) {
+    size_t pos = 0;
+    if (readRaw<uint32_t>(bytes, pos) != SKETCH_MAGIC) {
+        throw std::runtime_error("Not a serialized cardinality sketch");
+    }
+    const auto precision = readRaw<uint8_t>(bytes, pos);
+    if (precision < kMinPrecision || precision > kMaxPrecision) {
+        throw std::runtime_error("Corrupted cardinality sketch");
+    }
+    CardinalitySketch sketch(precision);
+    const auto dense = readRaw<uint8_t>(bytes, pos);
+    if (dense == 0) {
+        const uint32_t count = readRaw<uint32_t>(bytes, pos);
+        if (count > sketch.exactLimit() || pos + count * sizeof(uint64_t) != bytes.size()) {
+            throw std::runtime_error("Corrupted cardinality sketch");
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            sketch.insertExact(readRaw<uint64_t>(bytes, pos));
+        }
+        return sketch;
+    }
+    const size_t m = size_t{1} << precision;
+    if (dense != 1 || pos + m != bytes.size()) {
+        throw std::runtime_error("Corrupted cardinality sketch");
+    }
+    sketch.registers_.assign(bytes.begin() + static_cast<std::ptrdiff_t>(pos), bytes.end());
+    sketch.exact_ = std::vector<uint64_t>();
+    for (uint8_t r : sketch.registers_) {
+        if (r > 64 - precision + 1) {
+            throw std::runtime_error("Corrupted cardinality sketch");
+        }
+    }
+    return sketch;
+}
+
+template void CardinalitySketch::add<int32_t>(const int32_t*, size_t, const uint64_t*);
+template void CardinalitySketch::add<double>(const double*, size_t, const uint64_t*);
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,534 @@
+#include "../../include/Statistics_Module/Column.hpp"
+#include <limits>
+#include <algorithm>
+#include <bitset>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+void Column::reserve(size_t rows) {
+    // Remembered so that an Empty column reserves its buffer once the type is known
+    capacity_ = std::max(capacity_, rows);
+    validity_.reserve((rows + 63) / 64);
+    switch (type_) {
+        case ColumnType::Int:    ints_.reserve(rows); break;
+        case ColumnType::Double: doubles_.reserve(rows); break;
+        case ColumnType::String: codes_.reserve(rows); break;
+        case ColumnType::Mixed:  mixed_.reserve(rows); break;
+        case ColumnType::Empty:  break;
+    }
+}
+
+void Column::clear() {
+    type_ = ColumnType::Empty;
+    size_ = 0;
+    nullCount_ = 0;
+    validity_.clear();
+    ints_.clear();
+    doubles_.clear();
+    codes_.clear();
+    dictionary_.clear();
+    mixed_.clear();
+}
+
+void Column::pushValidity(bool valid) {
+    if ((size_ & 63) == 0) {
+        validity_.push_back(0);
+    }
+    if (valid) {
+        validity_.back() |= uint64_t{1} << (size_ & 63);
+    } else {
+        ++nullCount_;
+    }
+    ++size_;
+}
+
+void Column::appendNull() {
+    switch (type_) {
+        case ColumnType::Int:    ints_.push_back(0); break;
+        case ColumnType::Double: doubles_.push_back(std::numeric_limits<double>::quiet_NaN()); break;
+        case ColumnType::String: codes_.push_back(0); break;
+        case ColumnType::Mixed:  mixed_.emplace_back(0); break;
+        case ColumnType::Empty:  break;
+    }
+    pushValidity(false);
+}
+
+void Column::append(const OptionalDataValue& value) {
+    if (!value) {
+        appendNull();
+    } else if (std::holds_alternative<int>(*value)) {
+        appendInt(static_cast<int32_t>(std::get<int>(*value)));
+    } else if (std::holds_alternative<double>(*value)) {
+        appendDouble(std::get<double>(*value));
+    } else {
+        appendString(std::get<std::string>(*value));
+    }
+}
+
+void Column::appendInt(int32_t x) {
+    switch (type_) {
+        case ColumnType::Empty:
+            setType(ColumnType::Int, size_ + 1);
+            [[fallthrough]];
+        case ColumnType::Int:    ints_.push_back(x); break;
+        case ColumnType::Double: doubles_.push_back(static_cast<double>(x)); break;
+        case ColumnType::String: promoteToMixed(); mixed_.emplace_back(static_cast<int>(x)); break;
+        case ColumnType::Mixed:  mixed_.emplace_back(static_cast<int>(x)); break;
+    }
+    pushValidity(true);
+}
+
+void Column::appendDouble(double x) {
+    switch (type_) {
+        case ColumnType::Empty:
+            setType(ColumnType::Double, size_ + 1);
+            doubles_.push_back(x);
+            break;
+        case ColumnType::Int:    promoteToDouble(); doubles_.push_back(x); break;
+        case ColumnType::Double: doubles_.push_back(x); break;
+        case ColumnType::String: promoteToMixed(); mixed_.emplace_back(x); break;
+        case ColumnType::Mixed:  mixed_.emplace_back(x); break;
+    }
+    pushValidity(true);
+}
+
+void Column::appendString(std::string_view s) {
+    switch (type_) {
+        case ColumnType::Empty:
+            setType(ColumnType::String, size_ + 1);
+            [[fallthrough]];
+        case ColumnType::String: codes_.push_back(encode(s)); break;
+        case ColumnType::Int:
+        case ColumnType::Double: promoteToMixed(); mixed_.emplace_back(std::string(s)); break;
+        case ColumnType::Mixed:  mixed_.emplace_back(std::string(s)); break;
+    }
+    pushValidity(true);
+}
+
+void Column::setType(ColumnType type, size_t rows) {
+    type_ = type;
+    switch (type) {
+        case ColumnType::Int:
+            ints_.reserve(std::max(capacity_, rows));
+            ints_.assign(size_, 0);
+            break;
+        case ColumnType::Double:
+            doubles_.reserve(std::max(capacity_, rows));
+            doubles_.assign(size_, std::numeric_limits<double>::quiet_NaN());
+            break;
+        case ColumnType::String:
+            codes_.reserve(std::max(capacity_, rows));
+            codes_.assign(size_, 0);
+            break;
+        default:
+            break;
+    }
+}
+
+void Column::appendValidity(const uint64_t* bits, size_t count) {
+    const size_t offset = size_ & 63;
+    const size_t total = size_ + count;
+    const size_t words = (count + 63) / 64;
+    size_t valid = 0;
+    for (size_t w = 0; w < words; ++w) {
+        uint64_t word = bits ? bits[w] : ~uint64_t{0};
+        if (w + 1 == words && (count & 63)) {
+            word &= (uint64_t{1} << (count & 63)) - 1;
+        }
+        valid += std::bitset<64>(word).count();
+        if (offset == 0) {
+            validity_.push_back(word);
+        } else {
+            validity_.back() |= word << offset;
+            if (validity_.size() * 64 < total) {
+                validity_.push_back(word >> (64 - offset));
+            }
+        }
+    }
+    size_ = total;
+    nullCount_ += count - valid;
+}
+
+template <typename T>
+void Column::appendValues(const T* values, size_t count, const uint64_t* validity) {
+    auto present = [validity](size_t i) { return !validity || ((validity[i >> 6] >> (i & 63)) & 1u); };
+    if constexpr (std::is_same_v<T, std::string>) {
+        for (size_t i = 0; i < count; ++i) {
+            if (present(i)) {
+                appendString(values[i]);
+            } else {
+                appendNull();
+            }
+        }
+    } else {
+        constexpr ColumnType type = std::is_same_v<T, int32_t> ? ColumnType::Int : ColumnType::Double;
+        if (type_ == ColumnType::Empty) {
+            setType(type, size_ + count);
+        } else if (type_ == ColumnType::Int && type == ColumnType::Double) {
+            promoteToDouble();
+        }
+        if (type_ != ColumnType::Int && type_ != ColumnType::Double) {
+            for (size_t i = 0; i < count; ++i) {
+                if (!present(i)) {
+                    appendNull();
+                } else if constexpr (type == ColumnType::Int) {
+                    appendInt(values[i]);
+                } else {
+                    appendDouble(values[i]);
+                }
+            }
+            return;
+        }
+
+        // One copy (or conversion) of the whole array, then null rows get their placeholder.
+        // No exact reserve here: repeated batches must keep the geometric growth of the buffer.
+        const size_t first = size_;
+        const size_t nulls = nullCount_;
+        if (type_ == ColumnType::Int) {
+            ints_.append(values, values + count);
+        } else {
+            doubles_.append(values, values + count);
+        }
+        appendValidity(validity, count);
+        if (nullCount_ == nulls) {
+            return;
+        }
+        for (size_t w = 0; w < (count + 63) / 64; ++w) {
+            uint64_t missing = ~validity[w];
+            if (w + 1 == (count + 63) / 64 && (count & 63)) {
+                missing &= (uint64_t{1} << (count & 63)) - 1;
+            }
+            for (; missing != 0; missing &= missing - 1) {
+                size_t row = first + w * 64 + std::bitset<64>((missing & -missing) - 1).count();
+                if (type_ == ColumnType::Int) {
+                    ints_[row] = 0;
+                } else {
+                    doubles_[row] = std::numeric_limits<double>::quiet_NaN();
+                }
+            }
+        }
+    }
+}
+
+void Column::append(const Column& other) {
+    if (other.size_ == 0) {
+        return;
+    }
+    if (type_ == ColumnType::Int && other.type_ == ColumnType::Double) {
+        promoteToDouble();
+    } else if (type_ == ColumnType::Empty && other.type_ != ColumnType::Mixed) {
+        // Take the type of other so that its buffer is concatenated below
+        setType(other.type_, size_ + other.size_);
+    }
+
+    if (other.type_ == ColumnType::Empty && type_ != ColumnType::Mixed) {
+        for (size_t i = 0; i < other.size_; ++i) {
+            appendNull();
+        }
+    } else if (type_ == ColumnType::Int && other.type_ == ColumnType::Int) {
+        ints_.append(other.ints_.begin(), other.ints_.end());
+        appendValidity(other.validity_.data(), other.size_);
+    } else if (type_ == ColumnType::Double && other.type_ == ColumnType::Double) {
+        doubles_.append(other.doubles_.begin(), other.doubles_.end());
+        appendValidity(other.validity_.data(), other.size_);
+    } else if (type_ == ColumnType::Double && other.type_ == ColumnType::Int) {
+        for (size_t i = 0; i < other.size_; ++i) {
+            doubles_.push_back(other.isValid(i) ? static_cast<double>(other.ints_[i])
+                                                : std::numeric_limits<double>::quiet_NaN());
+        }
+        appendValidity(other.validity_.data(), other.size_);
+    } else if (type_ == ColumnType::String && other.type_ == ColumnType::String) {
+        std::vector<uint32_t> remap(other.dictionary_.size());
+        for (uint32_t c = 0; c < remap.size(); ++c) {
+            remap[c] = encode(other.dictionary_[c]);
+        }
+        for (size_t i = 0; i < other.size_; ++i) {
+            codes_.push_back(other.isValid(i) ? remap[other.codes_[i]] : 0);
+        }
+        appendValidity(other.validity_.data(), other.size_);
+    } else {
+        for (size_t i = 0; i < other.size_; ++i) {
+            append(other.at(i));
+        }
+    }
+}
+
+void Column::append(Column&& other) {
+    if (size_ == 0 && capacity_ <= other.size_) {
+        *this = std::move(other);
+        return;
+    }
+    append(static_cast<const Column&>(other));
+}
+
+template <typename T>
+Column Column::fromBuffers(Buffer<T> values, Buffer<uint64_t> validity, size_t nullCount, StringPool dictionary) {
+    Column column;
+    column.size_ = values.size();
+    const size_t words = (column.size_ + 63) / 64;
+    if (validity.empty() && words > 0) {
+        std::vector<uint64_t> bits(words, ~uint64_t{0});
+        if (column.size_ & 63) {
+            bits.back() = (uint64_t{1} << (column.size_ & 63)) - 1;
+        }
+        validity = Buffer<uint64_t>(std::move(bits));
+        nullCount = 0;
+    } else if (validity.size() != words) {
+        throw std::invalid_argument("Validity bitmap does not match the number of rows");
+    }
+    column.validity_ = std::move(validity);
+    column.nullCount_ = nullCount;
+    column.capacity_ = column.size_;
+
+    if constexpr (std::is_same_v<T, int32_t>) {
+        column.type_ = ColumnType::Int;
+        column.ints_ = std::move(values);
+    } else if constexpr (std::is_same_v<T, double>) {
+        column.type_ = ColumnType::Double;
+        column.doubles_ = std::move(values);
+    } else {
+        column.type_ = ColumnType::String;
+        column.codes_ = std::move(values);
+        column.dictionary_ = std::move(dictionary);
+    }
+    return column;
+}
+
+std::shared_ptr<const void> Column::shareValues() {
+    std::shared_ptr<const void> values;
+    switch (type_) {
+        case ColumnType::Int:    values = ints_.share(); break;
+        case ColumnType::Double: values = doubles_.share(); break;
+        case ColumnType::String: values = codes_.share(); break;
+        default: break;
+    }
+    auto validity = validity_.share();
+    if (!values) {
+        return validity;
+    }
+    // One owner for both buffers
+    return std::make_shared<const std::pair<std::shared_ptr<const void>, std::shared_ptr<const void>>>(
+        std::move(values), std::move(validity));
+}
+
+Column Column::masked(const uint64_t* selection, std::shared_ptr<const void> owner) const {
+    Column column;
+    column.type_ = type_;
+    column.size_ = size_;
+    column.capacity_ = size_;
+
+    const size_t words = (size_ + 63) / 64;
+    std::vector<uint64_t> bits(words);
+    size_t valid = 0;
+    for (size_t w = 0; w < words; ++w) {
+        bits[w] = validity_[w] & selection[w];
+        valid += std::bitset<64>(bits[w]).count();
+    }
+    column.validity_ = Buffer<uint64_t>(std::move(bits));
+    column.nullCount_ = size_ - valid;
+
+    switch (type_) {
+        case ColumnType::Int:
+            column.ints_ = Buffer<int32_t>(ints_.data(), ints_.size(), owner);
+            break;
+        case ColumnType::Double:
+            column.doubles_ = Buffer<double>(doubles_.data(), doubles_.size(), owner);
+            break;
+        case ColumnType::String:
+            column.codes_ = Buffer<uint32_t>(codes_.data(), codes_.size(), owner);
+            column.dictionary_ = dictionary_;
+            break;
+        case ColumnType::Mixed:
+            column.mixed_ = mixed_;
+            break;
+        case ColumnType::Empty:
+            break;
+    }
+    return column;
+}
+
+uint32_t Column::encode(std::string_view value) {
+    return dictionary_.intern(value);
+}
+
+void Column::promoteToDouble() {
+    doubles_.reserve(std::max(ints_.size(), capacity_));
+    doubles_.resize(ints_.size());
+    for (size_t i = 0; i < ints_.size(); ++i) {
+        doubles_[i] = isValid(i) ? static_cast<double>(ints_[i])
+                                 : std::numeric_limits<double>::quiet_NaN();
+    }
+    ints_ = Buffer<int32_t>();
+    type_ = ColumnType::Double;
+}
+
+void Column::promoteToMixed() {
+    mixed_.clear();
+    mixed_.reserve(std::max(size_, capacity_));
+    for (size_t i = 0; i < size_; ++i) {
+        switch (type_) {
+            case ColumnType::Int:    mixed_.emplace_back(static_cast<int>(ints_[i])); break;
+            case ColumnType::Double: mixed_.emplace_back(doubles_[i]); break;
+            case ColumnType::String: mixed_.emplace_back(std::string(dictionary_[codes_[i]])); break;
+            default:                 mixed_.emplace_back(0); break;
+        }
+    }
+    ints_ = Buffer<int32_t>();
+    doubles_ = Buffer<double>();
+    codes_ = Buffer<uint32_t>();
+    dictionary_ = StringPool();
+    type_ = ColumnType::Mixed;
+}
+
+OptionalDataValue Column::at(size_t row) const {
+    if (row >= size_) {
+        throw std::out_of_range("Row index out of range");
+    }
+    if (!isValid(row)) {
+        return std::nullopt;
+    }
+    switch (type_) {
+        case ColumnType::Int:    return DataValue(static_cast<int>(ints_[row]));
+        case ColumnType::Double: return DataValue(doubles_[row]);
+        case ColumnType::String: return DataValue(std::string(dictionary_[codes_[row]]));
+        case ColumnType::Mixed:  return mixed_[row];
+        case ColumnType::Empty:  break;
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+ColumnView<T> Column::view() const {
+    if constexpr (std::is_same_v<T, int32_t>) {
+        if (type_ == ColumnType::Int) {
+            return ColumnView<T>(ints_.data(), size_, validity_.data(), nullCount_);
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (type_ == ColumnType::Double) {
+            return ColumnView<T>(doubles_.data(), size_, validity_.data(), nullCount_);
+        }
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        if (type_ == ColumnType::String) {
+            return ColumnView<T>(codes_.data(), size_, validity_.data(), nullCount_);
+        }
+    }
+    throw std::runtime_error("Column storage type does not match the requested view type");
+}
+
+template <typename T>
+std::vector<T> Column::values() const {
+    std::vector<T> out;
+    out.reserve(size_ - nullCount_);
+
+    switch (type_) {
+        case ColumnType::Int:
+            if constexpr (std::is_arithmetic_v<T>) {
+                for (size_t i = 0; i < size_; ++i) {
+                    if (isValid(i)) out.push_back(static_cast<T>(ints_[i]));
+                }
+            }
+            break;
+        case ColumnType::Double:
+            if constexpr (std::is_arithmetic_v<T>) {
+                for (size_t i = 0; i < size_; ++i) {
+                    if (isValid(i)) out.push_back(static_cast<T>(doubles_[i]));
+                }
+            }
+            break;
+        case ColumnType::String:
+            if constexpr (std::is_same_v<T, std::string>) {
+                for (size_t i = 0; i < size_; ++i) {
+                    if (isValid(i)) out.emplace_back(dictionary_[codes_[i]]);
+                }
+            }
+            break;
+        case ColumnType::Mixed:
+            for (size_t i = 0; i < size_; ++i) {
+                if (!isValid(i)) continue;
+                const DataValue& v = mixed_[i];
+                if (std::holds_alternative<T>(v)) {
+                    out.push_back(std::get<T>(v));
+                } else if constexpr (std::is_arithmetic_v<T>) {
+                    if (std::holds_alternative<int>(v)) {
+                        out.push_back(static_cast<T>(std::get<int>(v)));
+                    } else if (std::holds_alternative<double>(v)) {
+                        out.push_back(static_cast<T>(std::get<double>(v)));
+                    }
+                }
+            }
+            break;
+        case ColumnType::Empty:
+            break;
+    }
+    return out;
+}
+
+std::vector<double> Column::asDoubles() const {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> out(size_, nan);
+    switch (type_) {
+        case ColumnType::Int:
+            for (size_t i = 0; i < size_; ++i) {
+                if (isValid(i)) out[i] = static_cast<double>(ints_[i]);
+            }
+            break;
+        case ColumnType::Double:
+            if (nullCount_ == 0) {
+                std::copy(doubles_.begin(), doubles_.end(), out.begin());
+                break;
+            }
+            // Null rows usually hold NaN, but masked rows (see masked()) keep their value
+            for (size_t i = 0; i < size_; ++i) {
+                if (isValid(i)) out[i] = doubles_[i];
+            }
+            break;
+        case ColumnType::Mixed:
+            for (size_t i = 0; i < size_; ++i) {
+                if (!isValid(i)) continue;
+                if (std::holds_alternative<int>(mixed_[i])) {
+                    out[i] = static_cast<double>(std::get<int>(mixed_[i]));
+                } else if (std::holds_alternative<double>(mixed_[i])) {
+                    out[i] = std::get<double>(mixed_[i]);
+                }
+            }
+            break;
+        case ColumnType::String:
+        case ColumnType::Empty:
+            break;
+    }
+    return out;
+}
+
+size_t Column::memoryUsage() const {
+    size_t bytes = validity_.capacity() * sizeof(uint64_t) +
+                   ints_.capacity() * sizeof(int32_t) +
+                   doubles_.capacity() * sizeof(double) +
+                   codes_.capacity() * sizeof(uint32_t) +
+                   dictionary_.memoryUsage() +
+                   mixed_.capacity() * sizeof(DataValue);
+    for (const auto& value : mixed_) {
+        if (const auto* s = std::get_if<std::string>(&value); s && s->capacity() > sizeof(std::string)) {
+            bytes += s->capacity();
+        }
+    }
+    return bytes;
+}
+
+template Column Column::fromBuffers<int32_t>(Buffer<int32_t>, Buffer<uint64_t>, size_t, StringPool);
+template Column Column::fromBuffers<double>(Buffer<double>, Buffer<uint64_t>, size_t, StringPool);
+template Column Column::fromBuffers<uint32_t>(Buffer<uint32_t>, Buffer<uint64_t>, size_t, StringPool);
+
+template void Column::appendValues<int32_t>(const int32_t*, size_t, const uint64_t*);
+template void Column::appendValues<double>(const double*, size_t, const uint64_t*);
+template void Column::appendValues<std::string>(const std::string*, size_t, const uint64_t*);
+
+template ColumnView<int32_t> Column::view<int32_t>() const;
+template ColumnView<double> Column::view<double>() const;
+template ColumnView<uint32_t> Column::view<uint32_t>() const;
+
+template std::vector<int> Column::values<int>() const;
+template std::vector<double> Column::values<double>() const;
+template std::vector<std::string> Column::values<std::string>() const;
+
+} // namespace ScientificToolbox::Statistics
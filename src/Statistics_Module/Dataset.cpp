@@ -1,75 +1,393 @@
 #include "../../include/Statistics_Module/Dataset.hpp"
 #include "../../include/Statistics_Module/Utils.hpp"
+#include "../../include/Utilities.hpp"
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 namespace ScientificToolbox::Statistics {
 
-Dataset::Dataset(const std::vector<std::unordered_map<std::string, OptionalDataValue>>& inputData) : data(inputData) {
-    if (data.empty()) {
+Dataset::Dataset(const std::vector<std::unordered_map<std::string, OptionalDataValue>>& inputData) {
+    if (inputData.empty()) {
         throw std::runtime_error("Cannot create dataset from empty data");
     }
+
+    initSchema(inputData.front());
+    for (auto& col : columns) {
+        col.reserve(inputData.size());
+    }
+    // Rows coming from the importer may omit trailing empty cells: treat them as nulls
+    for (const auto& r : inputData) {
+        appendRow(r);
+    }
+}
+
+
+/**
+ * @brief Importer sink appending parsed cells directly into the typed columns
+ */
+struct Dataset::CsvLoader {
+    Dataset& ds;
+
+    void header(const std::vector<std::string>& columnNames) { ds.initSchema(columnNames); }
+    void value(size_t col, int v) { ds.columns[col].appendInt(static_cast<int32_t>(v)); }
+    void value(size_t col, double v) { ds.columns[col].appendDouble(v); }
+    void value(size_t col, std::string_view v) { ds.columns[col].appendString(v); }
+    void null(size_t col) { ds.columns[col].appendNull(); }
+    void endRow() { ++ds.rows; }
+};
+
+
+/**
+ * @brief Importer sink handing out fixed-size batches and then reusing them
+ */
+struct Dataset::BatchLoader {
+    Dataset batch;
+    size_t batchRows;
+    const std::function<void(const Dataset&)>& onBatch;
+
+    void header(const std::vector<std::string>& columnNames) { batch.initSchema(columnNames); }
+    void value(size_t col, int v) { batch.columns[col].appendInt(static_cast<int32_t>(v)); }
+    void value(size_t col, double v) { batch.columns[col].appendDouble(v); }
+    void value(size_t col, std::string_view v) { batch.columns[col].appendString(v); }
+    void null(size_t col) { batch.columns[col].appendNull(); }
+    void endRow() {
+        if (++batch.rows == batchRows) {
+            flush();
+        }
+    }
+    void flush() {
+        if (batch.rows == 0) return;
+        onBatch(batch);
+        for (auto& col : batch.columns) {
+            col.clear();
+        }
+        batch.rows = 0;
+    }
+};
+
+
+void Dataset::streamCSV(const std::string& filename, size_t batchRows,
+                        const std::function<void(const Dataset&)>& onBatch) {
+    if (batchRows == 0) {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+    BatchLoader loader{Dataset(), batchRows, onBatch};
+    Importer importer;
+    importer.importMapped(filename, loader);
+    loader.flush();
 }
 
 
+Dataset Dataset::fromCSV(const std::string& filename, unsigned threads, const ImportOptions& options) {
+    Importer importer(options);
+    if (threads <= 1) {
+        Dataset ds;
+        CsvLoader loader{ds};
+        importer.importMapped(filename, loader);
+        return ds;
+    }
+
+    std::vector<Dataset> parts(threads);
+    std::vector<CsvLoader> loaders;
+    loaders.reserve(threads);
+    for (auto& part : parts) {
+        loaders.push_back(CsvLoader{part});
+    }
+    importer.importParallel(filename, loaders);
+
+    Dataset ds = std::move(parts[0]);
+    size_t total = 0;
+    for (const auto& part : parts) {
+        total += part.rows;
+    }
+    for (auto& col : ds.columns) {
+        col.reserve(total);
+    }
+    for (size_t k = 1; k < parts.size(); ++k) {
+        ds.append(parts[k]);
+    }
+    return ds;
+}
+
+
+Dataset Dataset::where(std::shared_ptr<Dataset> source, const Selection& rows) {
+    if (!source) {
+        throw std::invalid_argument("Dataset is empty");
+    }
+    if (rows.rows() != source->rows) {
+        throw std::invalid_argument("Selection does not cover the rows of the dataset");
+    }
+    Dataset out;
+    out.names = source->names;
+    out.index = source->index;
+    out.rows = source->rows;
+    out.columns.reserve(source->columns.size());
+    for (auto& column : source->columns) {
+        out.columns.push_back(column.masked(rows.bits().data(), column.shareValues()));
+    }
+    return out;
+}
+
+size_t Dataset::memoryUsage() const {
+    size_t bytes = 0;
+    for (const auto& column : columns) {
+        bytes += column.memoryUsage();
+    }
+    return bytes;
+}
+
 std::vector<std::string> Dataset::getColumnNames() const {
-    if (data.empty()) {
+    if (names.empty()) {
         throw std::runtime_error("Cannot get column names from empty dataset");
     }
-    
-    std::vector<std::string> names;
-    for (const auto& [key, _] : data[0]) {
+    return names;
+}
+
+
+const Column& Dataset::column(const std::string& columnName) const {
+    if (rows == 0) {
+        throw std::runtime_error("Data is empty");
+    }
+    auto it = index.find(columnName);
+    if (it == index.end()) {
+        throw std::runtime_error("Column '" + columnName + "' does not exist");
+    }
+    return columns[it->second];
+}
+
+
+std::shared_ptr<const void> Dataset::shareColumn(const std::string& columnName) {
+    const Column& source = column(columnName);
+    return columns[static_cast<size_t>(&source - columns.data())].shareValues();
+}
+
+
+Dataset::Row Dataset::row(size_t i) const {
+    if (i >= rows) {
+        throw std::out_of_range("Row index out of range");
+    }
+    Row r;
+    r.reserve(names.size());
+    for (size_t j = 0; j < names.size(); ++j) {
+        r.emplace(names[j], columns[j].at(i));
+    }
+    return r;
+}
+
+
+uint64_t Dataset::RevisionId::next() {
+    static std::atomic<uint64_t> counter{0};
+    return ++counter;
+}
+
+void Dataset::initSchema(const Row& r) {
+    for (const auto& [key, _] : r) {
+        index.emplace(key, names.size());
         names.push_back(key);
+        columns.emplace_back();
     }
-    return names;
+}
+
+
+void Dataset::initSchema(const std::vector<std::string>& columnNames) {
+    for (const auto& name : columnNames) {
+        if (!index.emplace(name, names.size()).second) {
+            throw std::runtime_error("Duplicate column name: " + name);
+        }
+        names.push_back(name);
+        columns.emplace_back();
+    }
+}
+
+
+void Dataset::appendRow(const Row& r) {
+    for (size_t j = 0; j < names.size(); ++j) {
+        auto it = r.find(names[j]);
+        columns[j].append(it != r.end() ? it->second : std::nullopt);
+    }
+    ++rows;
 }
 
 
 void Dataset::addRow(const std::unordered_map<std::string, OptionalDataValue>& row) {
     
-    if (!data.empty()) {
-        for (const auto& [key, _] : data[0]) {
+    if (names.empty()) {
+        initSchema(row);
+    } else {
+        for (const auto& key : names) {
             if (row.find(key) == row.end()) {
                 throw std::runtime_error("New row missing column: " + key);
             }
         }
     }
-    data.push_back(row);
+    appendRow(row);
 }
 
 
 
 
-bool Dataset::isNumericColumn(const std::string& columnName) const {
-    if (data.empty()) {
-        throw std::runtime_error("Cannot check column type in empty dataset");
+void Dataset::addRows(const std::vector<std::string>& columnNames,
+                      const std::vector<std::vector<OptionalDataValue>>& values) {
+    for (const auto& r : values) {
+        if (r.size() != columnNames.size()) {
+            throw std::runtime_error("Row has " + std::to_string(r.size()) + " values for " +
+                                     std::to_string(columnNames.size()) + " columns");
+        }
+    }
+    if (names.empty()) {
+        // Built aside so that a duplicate name leaves this dataset untouched
+        Dataset schema;
+        schema.initSchema(columnNames);
+        names = std::move(schema.names);
+        index = std::move(schema.index);
+        columns = std::move(schema.columns);
     }
 
-    
-    if (data[0].find(columnName) == data[0].end()) {
-        throw std::runtime_error("Column " + columnName + " not found");
+    // Position in a row -> column of the dataset, every column exactly once
+    std::vector<size_t> target(columnNames.size());
+    std::vector<bool> seen(names.size(), false);
+    for (size_t k = 0; k < columnNames.size(); ++k) {
+        auto it = index.find(columnNames[k]);
+        if (it == index.end()) {
+            throw std::runtime_error("Column '" + columnNames[k] + "' does not exist");
+        }
+        if (seen[it->second]) {
+            throw std::runtime_error("Duplicate column name: " + columnNames[k]);
+        }
+        seen[it->second] = true;
+        target[k] = it->second;
+    }
+    for (size_t j = 0; j < names.size(); ++j) {
+        if (!seen[j]) {
+            throw std::runtime_error("New rows missing column: " + names[j]);
+        }
     }
 
-    
-    for (const auto& row : data) {
-        const auto& value = row.at(columnName);
-        
-        if (!value) continue; 
+    for (size_t k = 0; k < target.size(); ++k) {
+        Column& column = columns[target[k]];
+        if (rows == 0) {
+            // Later batches rely on the geometric growth of the buffers instead
+            column.reserve(values.size());
+        }
+        for (const auto& r : values) {
+            column.append(r[k]);
+        }
+    }
+    rows += values.size();
+}
+
+
+void Dataset::appendBatch(ColumnBatch batch) {
+    if (batch.empty()) {
+        return;
+    }
+    const size_t count = batch.front().second.size();
+    for (const auto& [name, column] : batch) {
+        if (column.size() != count) {
+            throw std::runtime_error("Column '" + name + "' does not have the same number of rows as the batch");
+        }
+    }
+    if (names.empty()) {
+        Dataset out;
+        for (auto& [name, column] : batch) {
+            out.addColumn(name, std::move(column));
+        }
+        names = std::move(out.names);
+        index = std::move(out.index);
+        columns = std::move(out.columns);
+        rows = out.rows;
+        return;
+    }
+
+    std::vector<size_t> target(batch.size());
+    std::vector<bool> seen(names.size(), false);
+    for (size_t k = 0; k < batch.size(); ++k) {
+        auto it = index.find(batch[k].first);
+        if (it == index.end()) {
+            throw std::runtime_error("Column '" + batch[k].first + "' does not exist");
+        }
+        if (seen[it->second]) {
+            throw std::runtime_error("Duplicate column name: " + batch[k].first);
+        }
+        seen[it->second] = true;
+        target[k] = it->second;
+    }
+    if (batch.size() != names.size()) {
+        for (size_t j = 0; j < names.size(); ++j) {
+            if (!seen[j]) {
+                throw std::runtime_error("Appended batch missing column: " + names[j]);
+            }
+        }
+    }
+    for (size_t k = 0; k < batch.size(); ++k) {
+        columns[target[k]].append(std::move(batch[k].second));
+    }
+    rows += count;
+}
 
-        if (!std::holds_alternative<int>(value.value()) && 
-            !std::holds_alternative<double>(value.value())) {
-            return false;
+
+void Dataset::addColumn(const std::string& name, Column column) {
+    if (index.count(name)) {
+        throw std::runtime_error("Duplicate column name: " + name);
+    }
+    if (!names.empty() && column.size() != rows) {
+        throw std::runtime_error("Column '" + name + "' does not have the same number of rows as the dataset");
+    }
+    rows = column.size();
+    index.emplace(name, names.size());
+    names.push_back(name);
+    columns.push_back(std::move(column));
+}
+
+
+void Dataset::append(const Dataset& other) {
+    if (other.names.empty()) {
+        return;
+    }
+    if (names.empty()) {
+        *this = other;
+        return;
+    }
+
+    std::vector<size_t> source(names.size());
+    for (size_t j = 0; j < names.size(); ++j) {
+        auto it = other.index.find(names[j]);
+        if (it == other.index.end()) {
+            throw std::runtime_error("Appended dataset missing column: " + names[j]);
         }
+        source[j] = it->second;
+    }
+    for (size_t j = 0; j < names.size(); ++j) {
+        columns[j].append(other.columns[source[j]]);
+    }
+    rows += other.rows;
+}
+
+
+bool Dataset::isNumericColumn(const std::string& columnName) const {
+    if (rows == 0) {
+        throw std::runtime_error("Cannot check column type in empty dataset");
     }
 
-    return true;
+    auto it = index.find(columnName);
+    if (it == index.end()) {
+        throw std::runtime_error("Column " + columnName + " not found");
+    }
+
+    return columns[it->second].isNumeric();
 }
 
 
 // Template specialization for numeric types
 template<typename T>
 std::vector<T> Dataset::getColumn(const std::string& columnName) const {
-    return Utils::extractColumn<T>(data, columnName);
+    std::vector<T> columnData = column(columnName).values<T>();
+    if (columnData.empty()) {
+        throw std::runtime_error(
+            "No valid data of requested type found in column '" + columnName + "'");
+    }
+    return columnData;
 }
 
 
@@ -77,6 +395,4 @@ template std::vector<int> Dataset::getColumn<int>(const std::string&) const;
 template std::vector<double> Dataset::getColumn<double>(const std::string&) const;
 template std::vector<std::string> Dataset::getColumn<std::string>(const std::string&) const;
 
-// Iterator implementation is in header file since it's template-based
-
-} // namespace ScientificToolbox::Statistics
\ No newline at end of file
+} // namespace ScientificToolbox::Statistics
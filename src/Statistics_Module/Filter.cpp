@@ -0,0 +1,296 @@
+#include "../../include/Statistics_Module/Filter.hpp"
+#include "../../include/Statistics_Module/Kernels.hpp"
+#include "../../include/Statistics_Module/Parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Node of a filter expression
+ *
+ * Leaves test one column: Range (lo <= value <= hi), In (value in values),
+ * Null (value missing). Inner nodes combine the selections of their children.
+ */
+struct Filter::Node {
+    enum class Kind { Range, In, Null, And, Or, Not };
+
+    explicit Node(Kind kind, std::string column = "") : kind(kind), column(std::move(column)) {}
+
+    Kind kind;
+    std::string column;
+    double lo = 0.0;
+    double hi = 0.0;
+    std::vector<DataValue> values;
+    std::shared_ptr<const Node> left;
+    std::shared_ptr<const Node> right;
+};
+
+namespace {
+
+/// Rows per task; a multiple of 64 so that every chunk starts on a bitmap word
+constexpr size_t kRowsPerChunk = size_t{1} << 16;
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+/**
+ * @brief Fills the bitmap of selection chunk by chunk, in parallel
+ * @param select select(begin, end, words) sets the bits of rows [begin, end),
+ *        words pointing at the word of row begin
+ */
+template <typename Select>
+Selection selectChunks(size_t n, unsigned threads, Select&& select) {
+    Selection out(n);
+    uint64_t* bits = out.bits().data();
+    parallelFor((n + kRowsPerChunk - 1) / kRowsPerChunk, threads, [&](size_t c) {
+        size_t begin = c * kRowsPerChunk;
+        select(begin, std::min(n, begin + kRowsPerChunk), bits + begin / 64);
+    });
+    return out;
+}
+
+/// Sets the bits of the rows [begin, end) satisfying match(i)
+template <typename Match>
+void selectRows(size_t begin, size_t end, uint64_t* words, Match&& match) {
+    for (size_t i = begin; i < end; ++i) {
+        if (match(i)) words[(i - begin) >> 6] |= uint64_t{1} << ((i - begin) & 63);
+    }
+}
+
+/// Clears the bits of null rows in [begin, end), begin being a multiple of 64
+void maskNulls(const uint64_t* validity, size_t nullCount, size_t begin, size_t end, uint64_t* words) {
+    if (nullCount == 0) return;
+    for (size_t w = begin / 64; w < (end + 63) / 64; ++w) {
+        words[w - begin / 64] &= validity[w];
+    }
+}
+
+std::optional<double> numberOf(const DataValue& value) {
+    if (std::holds_alternative<int>(value)) return static_cast<double>(std::get<int>(value));
+    if (std::holds_alternative<double>(value)) return std::get<double>(value);
+    return std::nullopt;
+}
+
+/// Rows of a numeric or Mixed column whose value lies in [lo, hi]
+Selection selectRange(const Column& column, double lo, double hi, unsigned threads) {
+    const size_t n = column.size();
+    if (!(lo <= hi)) {
+        return Selection(n);
+    }
+    switch (column.type()) {
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                Kernels::selectBetween(view.data() + begin, end - begin, lo, hi, words);
+                maskNulls(view.validity(), view.nullCount(), begin, end, words);
+            });
+        }
+        case ColumnType::Int: {
+            // Integer rows in [lo, hi] are exactly those in [ceil(lo), floor(hi)]
+            constexpr double minInt = std::numeric_limits<int32_t>::min();
+            constexpr double maxInt = std::numeric_limits<int32_t>::max();
+            double first = std::max(std::ceil(lo), minInt);
+            double last = std::min(std::floor(hi), maxInt);
+            if (first > last) {
+                return Selection(n);
+            }
+            auto view = column.view<int32_t>();
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                Kernels::selectBetween(view.data() + begin, end - begin,
+                                       static_cast<int32_t>(first), static_cast<int32_t>(last), words);
+                maskNulls(view.validity(), view.nullCount(), begin, end, words);
+            });
+        }
+        case ColumnType::Mixed:
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                selectRows(begin, end, words, [&](size_t i) {
+                    auto value = column.at(i);
+                    auto number = value ? numberOf(*value) : std::nullopt;
+                    return number && lo <= *number && *number <= hi;
+                });
+            });
+        case ColumnType::String:
+            throw std::invalid_argument("Numeric comparison on a string column");
+        case ColumnType::Empty:
+            break;
+    }
+    return Selection(n);
+}
+
+/// Rows whose value is one of values
+Selection selectIn(const Column& column, const std::vector<DataValue>& values, unsigned threads) {
+    const size_t n = column.size();
+    std::vector<double> numbers;
+    std::vector<std::string> strings;
+    for (const auto& value : values) {
+        if (auto number = numberOf(value)) {
+            if (!std::isnan(*number)) numbers.push_back(*number);
+        } else {
+            strings.push_back(std::get<std::string>(value));
+        }
+    }
+    std::sort(numbers.begin(), numbers.end());
+    numbers.erase(std::unique(numbers.begin(), numbers.end()), numbers.end());
+
+    switch (column.type()) {
+        case ColumnType::String: {
+            // One flag per dictionary code, so rows only compare integers
+            std::vector<uint8_t> wanted(column.dictionary().size(), 0);
+            bool any = false;
+            for (const auto& s : strings) {
+                uint32_t code = column.codeOf(s);
+                if (code != StringPool::npos) {
+                    wanted[code] = 1;
+                    any = true;
+                }
+            }
+            if (!any) {
+                return Selection(n);
+            }
+            auto codes = column.view<uint32_t>();
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                selectRows(begin, end, words, [&](size_t i) { return wanted[codes[i]] != 0; });
+                maskNulls(codes.validity(), codes.nullCount(), begin, end, words);
+            });
+        }
+        case ColumnType::Int:
+        case ColumnType::Double: {
+            if (numbers.size() <= 1) {
+                // A single value is a degenerate range, matched by the SIMD kernels
+                return numbers.empty() ? Selection(n) : selectRange(column, numbers[0], numbers[0], threads);
+            }
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                auto isWanted = [&numbers](double v) { return std::binary_search(numbers.begin(), numbers.end(), v); };
+                if (column.type() == ColumnType::Int) {
+                    auto view = column.view<int32_t>();
+                    selectRows(begin, end, words, [&](size_t i) { return isWanted(view[i]); });
+                    maskNulls(view.validity(), view.nullCount(), begin, end, words);
+                } else {
+                    auto view = column.view<double>();
+                    selectRows(begin, end, words, [&](size_t i) { return isWanted(view[i]); });
+                    maskNulls(view.validity(), view.nullCount(), begin, end, words);
+                }
+            });
+        }
+        case ColumnType::Mixed:
+            return selectChunks(n, threads, [&](size_t begin, size_t end, uint64_t* words) {
+                selectRows(begin, end, words, [&](size_t i) {
+                    auto value = column.at(i);
+                    if (!value) return false;
+                    if (auto number = numberOf(*value)) {
+                        return std::binary_search(numbers.begin(), numbers.end(), *number);
+                    }
+                    return std::find(strings.begin(), strings.end(), std::get<std::string>(*value)) != strings.end();
+                });
+            });
+        case ColumnType::Empty:
+            break;
+    }
+    return Selection(n);
+}
+
+/// Rows where the column is null
+Selection selectNull(const Column& column) {
+    Selection valid(column.size());
+    auto& bits = valid.bits();
+    for (size_t i = 0; i < column.size(); ++i) {
+        if (column.isValid(i)) bits[i >> 6] |= uint64_t{1} << (i & 63);
+    }
+    return ~valid;
+}
+
+} // namespace
+
+Filter Filter::equal(const std::string& column, const DataValue& value) {
+    return isIn(column, {value});
+}
+
+Filter Filter::notEqual(const std::string& column, const DataValue& value) {
+    return ~equal(column, value) & notNull(column);
+}
+
+Filter Filter::less(const std::string& column, double value) {
+    if (value == -kInfinity) return between(column, kInfinity, -kInfinity);
+    return between(column, -kInfinity, std::nextafter(value, -kInfinity));
+}
+
+Filter Filter::lessEqual(const std::string& column, double value) {
+    return between(column, -kInfinity, value);
+}
+
+Filter Filter::greater(const std::string& column, double value) {
+    if (value == kInfinity) return between(column, kInfinity, -kInfinity);
+    return between(column, std::nextafter(value, kInfinity), kInfinity);
+}
+
+Filter Filter::greaterEqual(const std::string& column, double value) {
+    return between(column, value, kInfinity);
+}
+
+Filter Filter::between(const std::string& column, double lo, double hi) {
+    Node node(Node::Kind::Range, column);
+    node.lo = lo;
+    node.hi = hi;
+    return Filter(std::make_shared<const Node>(std::move(node)));
+}
+
+Filter Filter::isIn(const std::string& column, std::vector<DataValue> values) {
+    Node node(Node::Kind::In, column);
+    node.values = std::move(values);
+    return Filter(std::make_shared<const Node>(std::move(node)));
+}
+
+Filter Filter::isNull(const std::string& column) {
+    return Filter(std::make_shared<const Node>(Node::Kind::Null, column));
+}
+
+Filter Filter::notNull(const std::string& column) {
+    return ~isNull(column);
+}
+
+Filter Filter::operator&(const Filter& other) const {
+    Node out(Node::Kind::And);
+    out.left = node;
+    out.right = other.node;
+    return Filter(std::make_shared<const Node>(std::move(out)));
+}
+
+Filter Filter::operator|(const Filter& other) const {
+    Node out(Node::Kind::Or);
+    out.left = node;
+    out.right = other.node;
+    return Filter(std::make_shared<const Node>(std::move(out)));
+}
+
+Filter Filter::operator~() const {
+    Node out(Node::Kind::Not);
+    out.left = node;
+    return Filter(std::make_shared<const Node>(std::move(out)));
+}
+
+Selection Filter::evaluate(const Dataset& dataset, unsigned threads) const {
+    return evaluate(*node, dataset, resolveThreads(threads));
+}
+
+Selection Filter::evaluate(const Node& node, const Dataset& dataset, unsigned threads) {
+    switch (node.kind) {
+        case Node::Kind::Range:
+            return selectRange(dataset.column(node.column), node.lo, node.hi, threads);
+        case Node::Kind::In:
+            return selectIn(dataset.column(node.column), node.values, threads);
+        case Node::Kind::Null:
+            return selectNull(dataset.column(node.column));
+        case Node::Kind::And:
+            return evaluate(*node.left, dataset, threads) & evaluate(*node.right, dataset, threads);
+        case Node::Kind::Or:
+            return evaluate(*node.left, dataset, threads) | evaluate(*node.right, dataset, threads);
+        case Node::Kind::Not:
+            break;
+    }
+    return ~evaluate(*node.left, dataset, threads);
+}
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,156 @@
+#include "../../include/Statistics_Module/FrequencyTable.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/// splitmix64 finalizer: spreads every input bit over the whole word
+inline uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/// Maps equal keys to one representation (only floating point needs it)
+template <typename K>
+inline K canonical(const K& key) {
+    if constexpr (std::is_same_v<K, double>) {
+        if (std::isnan(key)) return std::numeric_limits<double>::quiet_NaN();
+        if (key == 0.0) return 0.0;
+    }
+    return key;
+}
+
+template <typename K>
+inline uint64_t hashKey(const K& key) {
+    if constexpr (std::is_same_v<K, double>) {
+        uint64_t bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return mix(bits);
+    } else if constexpr (std::is_same_v<K, std::string>) {
+        return mix(std::hash<std::string_view>{}(key));
+    } else {
+        return mix(static_cast<uint64_t>(key));
+    }
+}
+
+/// Key equality on canonical keys (NaN equals NaN)
+template <typename K>
+inline bool sameKey(const K& a, const K& b) {
+    if constexpr (std::is_same_v<K, double>) {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    } else {
+        return a == b;
+    }
+}
+
+/// Strict key order used to break count ties (NaN last)
+template <typename K>
+inline bool keyLess(const K& a, const K& b) {
+    if constexpr (std::is_same_v<K, double>) {
+        if (std::isnan(a)) return false;
+        if (std::isnan(b)) return true;
+    }
+    return a < b;
+}
+
+} // namespace
+
+template <typename K>
+FrequencyTable<K>::FrequencyTable(size_t expectedKeys) {
+    size_t capacity = 16;
+    while (capacity < 2 * expectedKeys) capacity *= 2;
+    keys_.resize(capacity);
+    counts_.assign(capacity, 0);
+}
+
+template <typename K>
+size_t FrequencyTable<K>::slotOf(const K& key) const {
+    const size_t mask = counts_.size() - 1;
+    size_t slot = hashKey(key) & mask;
+    while (counts_[slot] != 0 && !sameKey(keys_[slot], key)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template <typename K>
+void FrequencyTable<K>::rehash(size_t capacity) {
+    std::vector<K> keys(capacity);
+    std::vector<size_t> counts(capacity, 0);
+    keys.swap(keys_);
+    counts.swap(counts_);
+    for (size_t slot = 0; slot < counts.size(); ++slot) {
+        if (counts[slot] != 0) {
+            size_t target = slotOf(keys[slot]);
+            keys_[target] = std::move(keys[slot]);
+            counts_[target] = counts[slot];
+        }
+    }
+}
+
+template <typename K>
+void FrequencyTable<K>::add(const K& key, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    const K k = canonical(key);
+    size_t slot = slotOf(k);
+    if (counts_[slot] == 0) {
+        if (2 * (size_ + 1) > counts_.size()) {
+            rehash(2 * counts_.size());
+            slot = slotOf(k);
+        }
+        keys_[slot] = k;
+        ++size_;
+    }
+    counts_[slot] += count;
+    total_ += count;
+}
+
+template <typename K>
+void FrequencyTable<K>::merge(const FrequencyTable& other) {
+    other.forEach([this](const K& key, size_t count) { add(key, count); });
+}
+
+template <typename K>
+size_t FrequencyTable<K>::count(const K& key) const {
+    return counts_[slotOf(canonical(key))];
+}
+
+template <typename K>
+std::vector<std::pair<K, size_t>> FrequencyTable<K>::topK(size_t k) const {
+    std::vector<std::pair<K, size_t>> out;
+    out.reserve(size_);
+    forEach([&out](const K& key, size_t count) { out.emplace_back(key, count); });
+    auto byCount = [](const std::pair<K, size_t>& a, const std::pair<K, size_t>& b) {
+        if (a.second != b.second) return a.second > b.second;
+        return keyLess(a.first, b.first);
+    };
+    k = std::min(k, out.size());
+    std::partial_sort(out.begin(), out.begin() + k, out.end(), byCount);
+    out.resize(k);
+    return out;
+}
+
+template <typename K>
+std::unordered_map<K, size_t> FrequencyTable<K>::toMap() const {
+    std::unordered_map<K, size_t> out;
+    out.reserve(size_);
+    forEach([&out](const K& key, size_t count) { out.emplace(key, count); });
+    return out;
+}
+
+template class FrequencyTable<int32_t>;
+template class FrequencyTable<double>;
+template class FrequencyTable<std::string>;
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,452 @@
+#include "../../include/Statistics_Module/GroupBy.hpp"
+#include "../../include/Statistics_Module/Kernels.hpp"
+#include "../../include/Statistics_Module/Parallel.hpp"
+#include "../../include/Statistics_Module/Quantiles.hpp"
+#include "../../include/Statistics_Module/StringPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/// Rows handled per task when work is split by row ranges
+constexpr size_t kRowsPerTask = size_t{1} << 16;
+
+inline uint64_t mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @brief Flat open-addressing map from 64-bit keys to dense ids in insertion order
+ */
+class FlatIndex {
+public:
+    FlatIndex() : keys_(16), ids_(16, kEmpty) {}
+
+    /// Id of key, numbering it next if it is new
+    uint32_t idOf(uint64_t key) {
+        size_t slot = find(key);
+        if (ids_[slot] == kEmpty) {
+            if (2 * (order_.size() + 1) > ids_.size()) {
+                grow();
+                slot = find(key);
+            }
+            keys_[slot] = key;
+            ids_[slot] = static_cast<uint32_t>(order_.size());
+            order_.push_back(key);
+        }
+        return ids_[slot];
+    }
+
+    /// Keys by id
+    const std::vector<uint64_t>& keys() const { return order_; }
+
+private:
+    static constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+
+    size_t find(uint64_t key) const {
+        const size_t mask = ids_.size() - 1;
+        size_t slot = mix(key) & mask;
+        while (ids_[slot] != kEmpty && keys_[slot] != key) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void grow() {
+        keys_.assign(2 * keys_.size(), 0);
+        ids_.assign(keys_.size(), kEmpty);
+        for (size_t id = 0; id < order_.size(); ++id) {
+            size_t slot = find(order_[id]);
+            keys_[slot] = order_[id];
+            ids_[slot] = static_cast<uint32_t>(id);
+        }
+    }
+
+    std::vector<uint64_t> keys_;
+    std::vector<uint32_t> ids_;
+    std::vector<uint64_t> order_;
+};
+
+/**
+ * @brief Numbers the keys of rows [0, n) by first appearance, in parallel
+ * 
+ * Every range of rows numbers its keys in a private FlatIndex; the indexes are
+ * then merged in range order, which preserves the global order of first
+ * appearance, and the rows are relabelled with the global ids.
+ * 
+ * @param keyOf keyOf(i, key) stores the key of row i and returns true, or
+ *        returns false for a null key, which gets id 0
+ * @param base 1 if nulls are possible (id 0 reserved for them), else 0
+ * @param distinct Output: number of ids, including the null id if base is 1
+ */
+template <typename KeyOf>
+std::vector<uint32_t> densify(size_t n, unsigned threads, uint32_t base, KeyOf&& keyOf, size_t& distinct) {
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(resolveThreads(threads), (n + kRowsPerTask - 1) / kRowsPerTask));
+    constexpr uint32_t kNull = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> ids(n);
+    std::vector<FlatIndex> local(parts);
+    parallelFor(parts, threads, [&](size_t p) {
+        for (size_t i = n * p / parts; i < n * (p + 1) / parts; ++i) {
+            uint64_t key;
+            ids[i] = keyOf(i, key) ? local[p].idOf(key) : kNull;
+        }
+    });
+
+    FlatIndex global;
+    std::vector<std::vector<uint32_t>> remap(parts);
+    for (size_t p = 0; p < parts; ++p) {
+        remap[p].reserve(local[p].keys().size());
+        for (uint64_t key : local[p].keys()) {
+            remap[p].push_back(global.idOf(key) + base);
+        }
+    }
+    parallelFor(parts, threads, [&](size_t p) {
+        for (size_t i = n * p / parts; i < n * (p + 1) / parts; ++i) {
+            ids[i] = ids[i] == kNull ? 0 : remap[p][ids[i]];
+        }
+    });
+    distinct = global.keys().size() + base;
+    return ids;
+}
+
+/// Bits of a double key: -0.0 and 0.0 form one group, as do all NaNs
+inline uint64_t doubleKey(double v) {
+    if (v == 0.0) v = 0.0;
+    if (std::isnan(v)) v = std::numeric_limits<double>::quiet_NaN();
+    uint64_t key;
+    std::memcpy(&key, &v, sizeof(key));
+    return key;
+}
+
+/// Negative NaNs with a non-zero payload, never returned by doubleKey: tags of Mixed int and string keys
+constexpr uint64_t kIntKey = uint64_t{0xFFF1} << 48;
+constexpr uint64_t kStringKey = uint64_t{0xFFF2} << 48;
+
+/// Dense code of every row of a key column (0 for nulls)
+std::vector<uint32_t> encodeKey(const Column& column, unsigned threads, size_t& distinct) {
+    const size_t n = column.size();
+    switch (column.type()) {
+        case ColumnType::String: {
+            // Dictionary codes are already dense
+            auto codes = column.view<uint32_t>();
+            std::vector<uint32_t> out(n);
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = codes.isValid(i) ? codes[i] + 1 : 0;
+            }
+            distinct = column.dictionary().size() + 1;
+            return out;
+        }
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            return densify(n, threads, 1, [&view](size_t i, uint64_t& key) {
+                key = static_cast<uint32_t>(view[i]);
+                return view.isValid(i);
+            }, distinct);
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            return densify(n, threads, 1, [&view](size_t i, uint64_t& key) {
+                key = doubleKey(view[i]);
+                return view.isValid(i);
+            }, distinct);
+        }
+        case ColumnType::Mixed: {
+            // Rare fallback: ints and strings (by their code in a pool) are
+            // boxed in NaN patterns that doubleKey never returns
+            StringPool strings;
+            std::vector<uint64_t> keys(n);
+            std::vector<char> valid(n, 0);
+            for (size_t i = 0; i < n; ++i) {
+                auto value = column.at(i);
+                if (!value) continue;
+                valid[i] = 1;
+                if (const int* v = std::get_if<int>(&*value)) {
+                    keys[i] = kIntKey | static_cast<uint32_t>(*v);
+                } else if (const double* v = std::get_if<double>(&*value)) {
+                    keys[i] = doubleKey(*v);
+                } else {
+                    keys[i] = kStringKey | strings.intern(std::get<std::string>(*value));
+                }
+            }
+            return densify(n, threads, 1, [&keys, &valid](size_t i, uint64_t& key) {
+                key = keys[i];
+                return valid[i] != 0;
+            }, distinct);
+        }
+        case ColumnType::Empty:
+            break;
+    }
+    distinct = 1;
+    return std::vector<uint32_t>(n, 0);
+}
+
+/**
+ * @brief Gathers the present values of some rows of a column into a buffer
+ * @param rows Row indices
+ * @param out Cleared, then filled with the values of the valid rows
+ */
+void gather(const Column& column, const std::vector<double>& mixed,
+            const size_t* rows, size_t count, std::vector<double>& out) {
+    out.clear();
+    switch (column.type()) {
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            for (size_t r = 0; r < count; ++r) {
+                if (view.isValid(rows[r])) out.push_back(static_cast<double>(view[rows[r]]));
+            }
+            break;
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            for (size_t r = 0; r < count; ++r) {
+                if (view.isValid(rows[r])) out.push_back(view[rows[r]]);
+            }
+            break;
+        }
+        case ColumnType::Mixed:
+            for (size_t r = 0; r < count; ++r) {
+                if (!std::isnan(mixed[rows[r]])) out.push_back(mixed[rows[r]]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+Aggregate Aggregate::quantile(double probability) {
+    if (!(probability >= 0.0 && probability <= 1.0)) {
+        throw std::invalid_argument("Quantile probabilities must be in [0, 1]");
+    }
+    Aggregate a(AggregateKind::Quantile);
+    a.probability = probability;
+    return a;
+}
+
+Aggregate Aggregate::parse(const std::string& name) {
+    if (name == "count") return AggregateKind::Count;
+    if (name == "sum") return AggregateKind::Sum;
+    if (name == "mean") return AggregateKind::Mean;
+    if (name == "var" || name == "variance") return AggregateKind::Variance;
+    if (name == "std") return AggregateKind::StandardDeviation;
+    if (name == "min") return AggregateKind::Min;
+    if (name == "max") return AggregateKind::Max;
+    if (name == "median") return quantile(0.5);
+    if (name.size() > 1 && name[0] == 'p') {
+        size_t used = 0;
+        double percent = 0.0;
+        try {
+            percent = std::stod(name.substr(1), &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == name.size() - 1) {
+            return quantile(percent / 100.0);
+        }
+    }
+    throw std::invalid_argument("Unknown aggregate: " + name);
+}
+
+std::string Aggregate::suffix() const {
+    switch (kind) {
+        case AggregateKind::Count:             return "count";
+        case AggregateKind::Sum:               return "sum";
+        case AggregateKind::Mean:              return "mean";
+        case AggregateKind::Variance:          return "var";
+        case AggregateKind::StandardDeviation: return "std";
+        case AggregateKind::Min:               return "min";
+        case AggregateKind::Max:               return "max";
+        case AggregateKind::Quantile:          break;
+    }
+    std::ostringstream out;
+    out << 'p' << probability * 100.0;
+    return out.str();
+}
+
+GroupBy::GroupBy(std::shared_ptr<const Dataset> ds, std::vector<std::string> keyNames, unsigned threadCount,
+                 const Selection* rows)
+    : dataset(std::move(ds)), keys(std::move(keyNames)), threads(resolveThreads(threadCount)) {
+    if (!dataset) {
+        throw std::invalid_argument("Dataset is empty");
+    }
+    if (keys.empty()) {
+        throw std::invalid_argument("No key columns specified for grouping");
+    }
+    const size_t n = dataset->size();
+    if (rows && rows->rows() != n) {
+        throw std::invalid_argument("Selection does not cover the rows of the dataset");
+    }
+
+    // Combine the key codes pairwise: (code so far, next key code) -> dense id
+    size_t distinct = 0;
+    std::vector<uint32_t> codes = encodeKey(dataset->column(keys[0]), threads, distinct);
+    for (size_t j = 1; j < keys.size(); ++j) {
+        size_t next = 0;
+        std::vector<uint32_t> other = encodeKey(dataset->column(keys[j]), threads, next);
+        codes = densify(n, threads, 0, [&codes, &other, next](size_t i, uint64_t& key) {
+            key = static_cast<uint64_t>(codes[i]) * next + other[i];
+            return true;
+        }, distinct);
+    }
+    // Final numbering in order of first appearance. Unselected rows take the
+    // reserved id 0, which the shift below turns into kNoGroup
+    constexpr uint32_t kNoGroup = std::numeric_limits<uint32_t>::max();
+    const uint32_t base = rows ? 1 : 0;
+    size_t groupCount = 0;
+    rowGroup = densify(n, threads, base, [&codes, rows](size_t i, uint64_t& key) {
+        key = codes[i];
+        return !rows || rows->contains(i);
+    }, groupCount);
+    if (rows) {
+        for (auto& g : rowGroup) --g;
+        --groupCount;
+    }
+
+    // Stable counting sort of the rows by group
+    firstRow.assign(groupCount, 0);
+    offsets.assign(groupCount + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        if (rowGroup[i] == kNoGroup) continue;
+        if (offsets[rowGroup[i] + 1]++ == 0) firstRow[rowGroup[i]] = i;
+    }
+    for (size_t g = 0; g < groupCount; ++g) {
+        offsets[g + 1] += offsets[g];
+    }
+    sortedRows.resize(offsets.back());
+    std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < n; ++i) {
+        if (rowGroup[i] != kNoGroup) sortedRows[cursor[rowGroup[i]]++] = i;
+    }
+}
+
+Dataset GroupBy::keyColumns() const {
+    Dataset out;
+    for (const auto& key : keys) {
+        const Column& source = dataset->column(key);
+        Column column;
+        column.reserve(groups());
+        for (size_t row : firstRow) {
+            column.append(source.at(row));
+        }
+        out.addColumn(key, std::move(column));
+    }
+    return out;
+}
+
+Dataset GroupBy::size() const {
+    Dataset out = keyColumns();
+    Column counts;
+    counts.reserve(groups());
+    for (size_t g = 0; g < groups(); ++g) {
+        counts.appendInt(static_cast<int32_t>(offsets[g + 1] - offsets[g]));
+    }
+    out.addColumn("count", std::move(counts));
+    return out;
+}
+
+Dataset GroupBy::agg(const AggregationSpec& spec) const {
+    Dataset out = keyColumns();
+    const size_t groupCount = groups();
+
+    // Tasks are contiguous ranges of groups holding about kRowsPerTask rows
+    std::vector<size_t> taskStart{0};
+    for (size_t g = 0; g < groupCount; ++g) {
+        if (offsets[g + 1] - offsets[taskStart.back()] >= kRowsPerTask) taskStart.push_back(g + 1);
+    }
+    if (taskStart.back() != groupCount) taskStart.push_back(groupCount);
+
+    for (const auto& [name, aggregates] : spec) {
+        const Column& column = dataset->column(name);
+        bool countOnly = std::all_of(aggregates.begin(), aggregates.end(),
+                                     [](const Aggregate& a) { return a.kind == AggregateKind::Count; });
+        // Counts are of non-null values; only Mixed columns can hold non-numeric ones
+        bool countNonNumeric = column.type() == ColumnType::Mixed &&
+                               std::any_of(aggregates.begin(), aggregates.end(),
+                                           [](const Aggregate& a) { return a.kind == AggregateKind::Count; });
+        if (!column.isNumeric() && column.type() != ColumnType::Mixed && !countOnly) {
+            throw std::invalid_argument("Column '" + name + "' is not numeric");
+        }
+        const std::vector<double> mixed = column.type() == ColumnType::Mixed ? column.asDoubles() : std::vector<double>();
+
+        std::vector<double> probabilities;
+        for (const auto& a : aggregates) {
+            if (a.kind == AggregateKind::Quantile) probabilities.push_back(a.probability);
+        }
+
+        // results[a][g]; NaN marks an undefined aggregate (no value in the group)
+        std::vector<std::vector<double>> results(aggregates.size(), std::vector<double>(groupCount));
+        parallelFor(taskStart.size() - 1, threads, [&](size_t t) {
+            std::vector<double> values;
+            for (size_t g = taskStart[t]; g < taskStart[t + 1]; ++g) {
+                const size_t* rows = sortedRows.data() + offsets[g];
+                const size_t count = offsets[g + 1] - offsets[g];
+                size_t present = 0, nonNull = 0;
+                if (countOnly || countNonNumeric) {
+                    for (size_t r = 0; r < count; ++r) nonNull += column.isValid(rows[r]);
+                }
+                if (!countOnly) {
+                    gather(column, mixed, rows, count, values);
+                    present = values.size();
+                }
+                if (!countNonNumeric && !countOnly) {
+                    nonNull = present;
+                }
+
+                constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+                double sum = nan, mean = nan, var = nan, lo = nan, hi = nan;
+                std::vector<double> q(probabilities.size(), nan);
+                if (present > 0 && !countOnly) {
+                    sum = Kernels::compensatedSum(values.data(), present);
+                    mean = sum / present;
+                    var = Kernels::sumSquaredDeviations(values.data(), present, mean) / present;
+                    Kernels::minMax(values.data(), present, lo, hi);
+                    if (!probabilities.empty()) q = quantilesInPlace(values, probabilities);
+                }
+                size_t next = 0;
+                for (size_t a = 0; a < aggregates.size(); ++a) {
+                    double& r = results[a][g];
+                    switch (aggregates[a].kind) {
+                        case AggregateKind::Count:             r = static_cast<double>(nonNull); break;
+                        case AggregateKind::Sum:               r = present ? sum : 0.0; break;
+                        case AggregateKind::Mean:              r = mean; break;
+                        case AggregateKind::Variance:          r = var; break;
+                        case AggregateKind::StandardDeviation: r = std::sqrt(var); break;
+                        case AggregateKind::Min:               r = lo; break;
+                        case AggregateKind::Max:               r = hi; break;
+                        case AggregateKind::Quantile:          r = q[next++]; break;
+                    }
+                }
+            }
+        });
+
+        for (size_t a = 0; a < aggregates.size(); ++a) {
+            Column result;
+            result.reserve(groupCount);
+            for (double r : results[a]) {
+                if (aggregates[a].kind == AggregateKind::Count) {
+                    result.appendInt(static_cast<int32_t>(r));
+                } else if (std::isnan(r)) {
+                    result.appendNull();
+                } else {
+                    result.appendDouble(r);
+                }
+            }
+            out.addColumn(name + "_" + aggregates[a].suffix(), std::move(result));
+        }
+    }
+    return out;
+}
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,220 @@
+#include "../../include/Statistics_Module/Histogram.hpp"
+#include "../../include/Statistics_Module/Kernels.hpp"
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/// Values binned per kernel call; a multiple of 64 so blocks start on a validity word
+constexpr size_t kBlock = 512;
+
+/// Largest number of bins: every slot must fit the int32 conversion of the kernels
+constexpr size_t kMaxBins = (size_t{1} << 31) - 3;
+
+void checkBins(size_t bins) {
+    if (bins == 0 || bins > kMaxBins) {
+        throw std::invalid_argument("Number of bins out of range");
+    }
+}
+
+} // namespace
+
+Histogram::Histogram(Scale scale, std::vector<double> edges)
+    : scale_(scale), edges_(std::move(edges)), lo_(edges_.front()), hi_(edges_.back()),
+      counts_(edges_.size() - 1, 0) {
+    if (scale_ == Scale::Log) {
+        lo_ = std::log(lo_);
+        hi_ = std::log(hi_);
+    }
+}
+
+Histogram Histogram::linear(double lo, double hi, size_t bins) {
+    checkBins(bins);
+    if (!(std::isfinite(lo) && std::isfinite(hi) && lo < hi)) {
+        throw std::invalid_argument("Histogram range must be finite with lo < hi");
+    }
+    std::vector<double> edges(bins + 1);
+    const double width = (hi - lo) / static_cast<double>(bins);
+    for (size_t b = 0; b < bins; ++b) {
+        edges[b] = lo + static_cast<double>(b) * width;
+    }
+    edges[bins] = hi;
+    return Histogram(Scale::Linear, std::move(edges));
+}
+
+Histogram Histogram::logarithmic(double lo, double hi, size_t bins) {
+    checkBins(bins);
+    if (!(std::isfinite(lo) && std::isfinite(hi) && 0.0 < lo && lo < hi)) {
+        throw std::invalid_argument("Logarithmic histogram range must be finite with 0 < lo < hi");
+    }
+    std::vector<double> edges(bins + 1);
+    const double logLo = std::log(lo);
+    const double step = (std::log(hi) - logLo) / static_cast<double>(bins);
+    edges[0] = lo;
+    for (size_t b = 1; b < bins; ++b) {
+        edges[b] = std::exp(logLo + static_cast<double>(b) * step);
+    }
+    edges[bins] = hi;
+    return Histogram(Scale::Log, std::move(edges));
+}
+
+Histogram Histogram::fromEdges(std::vector<double> edges) {
+    if (edges.size() < 2) {
+        throw std::invalid_argument("A histogram needs at least two edges");
+    }
+    checkBins(edges.size() - 1);
+    for (size_t b = 0; b < edges.size(); ++b) {
+        if (!std::isfinite(edges[b]) || (b > 0 && !(edges[b - 1] < edges[b]))) {
+            throw std::invalid_argument("Histogram edges must be finite and strictly increasing");
+        }
+    }
+    return Histogram(Scale::Edges, std::move(edges));
+}
+
+void Histogram::slotsOf(const double* values, size_t n, uint32_t* slots) const {
+    const uint32_t bins = static_cast<uint32_t>(counts_.size());
+    switch (scale_) {
+        case Scale::Linear:
+            Kernels::binIndices(values, n, lo_, hi_, bins, slots);
+            break;
+        case Scale::Log: {
+            // Zero and negative values map to -inf, hence to the underflow
+            double logs[kBlock];
+            for (size_t begin = 0; begin < n; begin += kBlock) {
+                const size_t m = std::min(kBlock, n - begin);
+                for (size_t i = 0; i < m; ++i) {
+                    logs[i] = std::log(std::max(values[begin + i], 0.0));
+                }
+                Kernels::binIndices(logs, m, lo_, hi_, bins, slots + begin);
+            }
+            break;
+        }
+        case Scale::Edges: {
+            // Binary search with a fixed number of steps: the loop only depends on bins
+            const double* edges = edges_.data();
+            const double first = edges_.front(), last = edges_.back();
+            for (size_t i = 0; i < n; ++i) {
+                const double v = values[i];
+                size_t base = 0;
+                for (size_t len = bins; len > 1; len -= len / 2) {
+                    base = edges[base + len / 2] <= v ? base + len / 2 : base;
+                }
+                uint32_t slot = static_cast<uint32_t>(base) + 1;
+                slot = v < first ? 0 : slot;
+                slot = v > last ? bins + 1 : slot;
+                slots[i] = v != v ? bins + 2 : slot;
+            }
+            break;
+        }
+    }
+}
+
+void Histogram::add(double value) {
+    uint32_t slot;
+    slotsOf(&value, 1, &slot);
+    const uint32_t bins = static_cast<uint32_t>(counts_.size());
+    if (slot == 0) {
+        ++underflow_;
+    } else if (slot <= bins) {
+        ++counts_[slot - 1];
+        ++total_;
+    } else if (slot == bins + 1) {
+        ++overflow_;
+    } else {
+        ++nan_;
+    }
+}
+
+void Histogram::add(const double* values, size_t n, const uint64_t* validity) {
+    const uint32_t bins = static_cast<uint32_t>(counts_.size());
+    const uint32_t skipped = bins + 3;
+    const size_t slots = bins + 4;
+    // Large inputs count into four interleaved copies of the counters, so that
+    // runs of values in the same bin do not serialize on one memory location
+    const size_t lanes = n >= kBlock ? 4 : 1;
+    std::vector<uint64_t> partial(lanes * slots, 0);
+
+    uint32_t block[kBlock];
+    for (size_t begin = 0; begin < n; begin += kBlock) {
+        const size_t m = std::min(kBlock, n - begin);
+        slotsOf(values + begin, m, block);
+        if (validity) {
+            for (size_t w = 0; w < (m + 63) / 64; ++w) {
+                uint64_t missing = ~validity[begin / 64 + w];
+                if (m - w * 64 < 64) {
+                    missing &= (uint64_t{1} << (m - w * 64)) - 1;
+                }
+                for (; missing != 0; missing &= missing - 1) {
+                    block[w * 64 + std::bitset<64>((missing & -missing) - 1).count()] = skipped;
+                }
+            }
+        }
+        for (size_t i = 0; i < m; ++i) {
+            ++partial[(i & (lanes - 1)) * slots + block[i]];
+        }
+    }
+
+    for (size_t lane = 1; lane < lanes; ++lane) {
+        for (size_t s = 0; s < slots; ++s) {
+            partial[s] += partial[lane * slots + s];
+        }
+    }
+    underflow_ += partial[0];
+    for (size_t b = 0; b < bins; ++b) {
+        counts_[b] += partial[b + 1];
+        total_ += partial[b + 1];
+    }
+    overflow_ += partial[bins + 1];
+    nan_ += partial[bins + 2];
+}
+
+void Histogram::clear() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    underflow_ = overflow_ = nan_ = total_ = 0;
+}
+
+void Histogram::merge(const Histogram& other) {
+    if (scale_ != other.scale_ || edges_ != other.edges_) {
+        throw std::invalid_argument("Cannot merge histograms with different bins");
+    }
+    for (size_t b = 0; b < counts_.size(); ++b) {
+        counts_[b] += other.counts_[b];
+    }
+    underflow_ += other.underflow_;
+    overflow_ += other.overflow_;
+    nan_ += other.nan_;
+    total_ += other.total_;
+}
+
+double Histogram::quantile(double probability) const {
+    if (!(probability >= 0.0 && probability <= 1.0)) {
+        throw std::invalid_argument("Probability must be in [0, 1]");
+    }
+    if (total_ == 0) {
+        throw std::runtime_error("Histogram has no value inside its bins");
+    }
+    const double target = probability * static_cast<double>(total_);
+    double below = 0.0;
+    size_t b = 0;
+    for (; b + 1 < counts_.size(); ++b) {
+        if (counts_[b] > 0 && below + static_cast<double>(counts_[b]) >= target) break;
+        below += static_cast<double>(counts_[b]);
+    }
+    // Past the last non-empty bin only when target rounds above total_
+    while (counts_[b] == 0) {
+        --b;
+        below -= static_cast<double>(counts_[b]);
+    }
+    const double fraction = std::clamp((target - below) / static_cast<double>(counts_[b]), 0.0, 1.0);
+    const double left = edges_[b], right = edges_[b + 1];
+    if (scale_ == Scale::Log) {
+        return left * std::pow(right / left, fraction);
+    }
+    return left + fraction * (right - left);
+}
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,546 @@
+#include "../../include/Statistics_Module/Kernels.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STATS_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ScientificToolbox::Statistics::Kernels {
+
+namespace {
+
+/// Neumaier step: adds x to (s, c), c collecting the rounding error
+inline void neumaier(double& s, double& c, double x) {
+    double t = s + x;
+    if (std::abs(s) >= std::abs(x)) {
+        c += (s - t) + x;
+    } else {
+        c += (x - t) + s;
+    }
+    s = t;
+}
+
+/// Combines per-lane compensated sums into one value
+inline double combineLanes(const double* sums, const double* comps, size_t lanes) {
+    double s = 0.0, c = 0.0;
+    for (size_t l = 0; l < lanes; ++l) {
+        neumaier(s, c, sums[l]);
+        neumaier(s, c, comps[l]);
+    }
+    return s + c;
+}
+
+// Scalar kernels: four independent lanes so the compiler can overlap the adds
+
+double sumScalar(const double* x, size_t n) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc[0] += x[i];
+        acc[1] += x[i + 1];
+        acc[2] += x[i + 2];
+        acc[3] += x[i + 3];
+    }
+    for (; i < n; ++i) acc[0] += x[i];
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+double compensatedSumScalar(const double* x, size_t n) {
+    double s[4] = {0.0, 0.0, 0.0, 0.0};
+    double c[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t l = 0; l < 4; ++l) neumaier(s[l], c[l], x[i + l]);
+    }
+    for (; i < n; ++i) neumaier(s[0], c[0], x[i]);
+    return combineLanes(s, c, 4);
+}
+
+double sumSquaredDeviationsScalar(const double* x, size_t n, double center) {
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t l = 0; l < 4; ++l) {
+            double d = x[i + l] - center;
+            acc[l] += d * d;
+        }
+    }
+    for (; i < n; ++i) {
+        double d = x[i] - center;
+        acc[0] += d * d;
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+void minMaxScalar(const double* x, size_t n, double& mn, double& mx) {
+    double lo[4] = {x[0], x[0], x[0], x[0]};
+    double hi[4] = {x[0], x[0], x[0], x[0]};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (size_t l = 0; l < 4; ++l) {
+            lo[l] = std::min(lo[l], x[i + l]);
+            hi[l] = std::max(hi[l], x[i + l]);
+        }
+    }
+    for (; i < n; ++i) {
+        lo[0] = std::min(lo[0], x[i]);
+        hi[0] = std::max(hi[0], x[i]);
+    }
+    mn = std::min(std::min(lo[0], lo[1]), std::min(lo[2], lo[3]));
+    mx = std::max(std::max(hi[0], hi[1]), std::max(hi[2], hi[3]));
+}
+
+/// Bits of the values of x[0, count) inside [lo, hi], count <= 64
+template <typename T>
+inline uint64_t betweenWord(const T* x, size_t count, T lo, T hi) {
+    uint64_t word = 0;
+    for (size_t j = 0; j < count; ++j) {
+        word |= static_cast<uint64_t>(x[j] >= lo && x[j] <= hi) << j;
+    }
+    return word;
+}
+
+template <typename T>
+void selectBetweenScalar(const T* x, size_t n, T lo, T hi, uint64_t* bits) {
+    for (size_t begin = 0; begin < n; begin += 64) {
+        bits[begin / 64] = betweenWord(x + begin, std::min<size_t>(64, n - begin), lo, hi);
+    }
+}
+
+/// Slot of one value, see binIndices; the selects compile to conditional moves
+inline uint32_t binSlot(double v, double lo, double hi, double scale, uint32_t bins) {
+    double t = (v - lo) * scale;
+    t = t < bins - 1.0 ? t : bins - 1.0;   // also maps NaN to the last bin
+    t = t > 0.0 ? t : 0.0;
+    uint32_t slot = static_cast<uint32_t>(t) + 1;
+    slot = v < lo ? 0 : slot;
+    slot = v > hi ? bins + 1 : slot;
+    return v != v ? bins + 2 : slot;
+}
+
+void binIndicesScalar(const double* x, size_t n, double lo, double hi, uint32_t bins, uint32_t* slots) {
+    const double scale = bins / (hi - lo);
+    for (size_t i = 0; i < n; ++i) {
+        slots[i] = binSlot(x[i], lo, hi, scale, bins);
+    }
+}
+
+#ifdef STATS_KERNELS_X86
+
+// AVX2 kernels: two 4-wide accumulators per reduction
+
+__attribute__((target("avx2")))
+double sumAVX2(const double* x, size_t n) {
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        a0 = _mm256_add_pd(a0, _mm256_loadu_pd(x + i));
+        a1 = _mm256_add_pd(a1, _mm256_loadu_pd(x + i + 4));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(a0, a1));
+    double tail = 0.0;
+    for (; i < n; ++i) tail += x[i];
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + tail;
+}
+
+__attribute__((target("avx2")))
+double compensatedSumAVX2(const double* x, size_t n) {
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    __m256d s = _mm256_setzero_pd(), c = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(x + i);
+        __m256d t = _mm256_add_pd(s, v);
+        __m256d bigS = _mm256_cmp_pd(_mm256_andnot_pd(signMask, s), _mm256_andnot_pd(signMask, v), _CMP_GE_OQ);
+        __m256d errS = _mm256_add_pd(_mm256_sub_pd(s, t), v);
+        __m256d errV = _mm256_add_pd(_mm256_sub_pd(v, t), s);
+        c = _mm256_add_pd(c, _mm256_blendv_pd(errV, errS, bigS));
+        s = t;
+    }
+    alignas(32) double sums[5];
+    alignas(32) double comps[5];
+    _mm256_store_pd(sums, s);
+    _mm256_store_pd(comps, c);
+    sums[4] = 0.0;
+    comps[4] = 0.0;
+    for (; i < n; ++i) neumaier(sums[4], comps[4], x[i]);
+    return combineLanes(sums, comps, 5);
+}
+
+__attribute__((target("avx2")))
+double sumSquaredDeviationsAVX2(const double* x, size_t n, double center) {
+    const __m256d m = _mm256_set1_pd(center);
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(x + i), m);
+        __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(x + i + 4), m);
+        a0 = _mm256_add_pd(a0, _mm256_mul_pd(d0, d0));
+        a1 = _mm256_add_pd(a1, _mm256_mul_pd(d1, d1));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(a0, a1));
+    double tail = 0.0;
+    for (; i < n; ++i) {
+        double d = x[i] - center;
+        tail += d * d;
+    }
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + tail;
+}
+
+__attribute__((target("avx2")))
+void minMaxAVX2(const double* x, size_t n, double& mn, double& mx) {
+    __m256d lo = _mm256_set1_pd(x[0]), hi = lo;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(x + i);
+        // Operand order matches std::min/std::max: a NaN in v keeps the running extreme
+        lo = _mm256_min_pd(v, lo);
+        hi = _mm256_max_pd(v, hi);
+    }
+    alignas(32) double l[4], h[4];
+    _mm256_store_pd(l, lo);
+    _mm256_store_pd(h, hi);
+    mn = std::min(std::min(l[0], l[1]), std::min(l[2], l[3]));
+    mx = std::max(std::max(h[0], h[1]), std::max(h[2], h[3]));
+    for (; i < n; ++i) {
+        mn = std::min(mn, x[i]);
+        mx = std::max(mx, x[i]);
+    }
+}
+
+// AVX-512 kernels: 8-wide lanes, masked tails. Horizontal reductions go
+// through memory instead of _mm512_reduce_*, which trips -Wuninitialized in GCC 12.
+
+__attribute__((target("avx512f")))
+inline double horizontalSum(__m512d v) {
+    alignas(64) double lanes[8];
+    _mm512_store_pd(lanes, v);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+__attribute__((target("avx512f")))
+double sumAVX512(const double* x, size_t n) {
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        a0 = _mm512_add_pd(a0, _mm512_loadu_pd(x + i));
+        a1 = _mm512_add_pd(a1, _mm512_loadu_pd(x + i + 8));
+    }
+    for (; i < n; i += 8) {
+        __mmask8 k = static_cast<__mmask8>(n - i >= 8 ? 0xFF : (1u << (n - i)) - 1);
+        a0 = _mm512_add_pd(a0, _mm512_maskz_loadu_pd(k, x + i));
+    }
+    return horizontalSum(_mm512_add_pd(a0, a1));
+}
+
+__attribute__((target("avx512f")))
+double compensatedSumAVX512(const double* x, size_t n) {
+    __m512d s = _mm512_setzero_pd(), c = _mm512_setzero_pd();
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 k = static_cast<__mmask8>(n - i >= 8 ? 0xFF : (1u << (n - i)) - 1);
+        __m512d v = _mm512_maskz_loadu_pd(k, x + i);
+        __m512d t = _mm512_add_pd(s, v);
+        __mmask8 bigS = _mm512_cmp_pd_mask(_mm512_abs_pd(s), _mm512_abs_pd(v), _CMP_GE_OQ);
+        __m512d errS = _mm512_add_pd(_mm512_sub_pd(s, t), v);
+        __m512d errV = _mm512_add_pd(_mm512_sub_pd(v, t), s);
+        c = _mm512_add_pd(c, _mm512_mask_blend_pd(bigS, errV, errS));
+        s = t;
+    }
+    alignas(64) double sums[8];
+    alignas(64) double comps[8];
+    _mm512_store_pd(sums, s);
+    _mm512_store_pd(comps, c);
+    return combineLanes(sums, comps, 8);
+}
+
+__attribute__((target("avx512f")))
+double sumSquaredDeviationsAVX512(const double* x, size_t n, double center) {
+    const __m512d m = _mm512_set1_pd(center);
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(x + i), m);
+        __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(x + i + 8), m);
+        a0 = _mm512_add_pd(a0, _mm512_mul_pd(d0, d0));
+        a1 = _mm512_add_pd(a1, _mm512_mul_pd(d1, d1));
+    }
+    for (; i < n; i += 8) {
+        __mmask8 k = static_cast<__mmask8>(n - i >= 8 ? 0xFF : (1u << (n - i)) - 1);
+        __m512d d = _mm512_maskz_sub_pd(k, _mm512_maskz_loadu_pd(k, x + i), m);
+        a0 = _mm512_add_pd(a0, _mm512_mul_pd(d, d));
+    }
+    return horizontalSum(_mm512_add_pd(a0, a1));
+}
+
+__attribute__((target("avx512f")))
+void minMaxAVX512(const double* x, size_t n, double& mn, double& mx) {
+    __m512d lo = _mm512_set1_pd(x[0]), hi = lo;
+    for (size_t i = 0; i < n; i += 8) {
+        __mmask8 k = static_cast<__mmask8>(n - i >= 8 ? 0xFF : (1u << (n - i)) - 1);
+        // Masked-off lanes keep the current extremes
+        __m512d v = _mm512_maskz_loadu_pd(k, x + i);
+        lo = _mm512_mask_min_pd(lo, k, v, lo);
+        hi = _mm512_mask_max_pd(hi, k, v, hi);
+    }
+    alignas(64) double l[8], h[8];
+    _mm512_store_pd(l, lo);
+    _mm512_store_pd(h, hi);
+    mn = l[0];
+    mx = h[0];
+    for (size_t j = 1; j < 8; ++j) {
+        mn = std::min(mn, l[j]);
+        mx = std::max(mx, h[j]);
+    }
+}
+
+// Selection kernels: one comparison mask per vector, packed 64 rows to a word
+
+__attribute__((target("avx2")))
+void selectBetweenAVX2(const double* x, size_t n, double lo, double hi, uint64_t* bits) {
+    const __m256d vlo = _mm256_set1_pd(lo), vhi = _mm256_set1_pd(hi);
+    size_t begin = 0;
+    for (; begin + 64 <= n; begin += 64) {
+        uint64_t word = 0;
+        for (size_t j = 0; j < 64; j += 4) {
+            __m256d v = _mm256_loadu_pd(x + begin + j);
+            __m256d in = _mm256_and_pd(_mm256_cmp_pd(v, vlo, _CMP_GE_OQ), _mm256_cmp_pd(v, vhi, _CMP_LE_OQ));
+            word |= static_cast<uint64_t>(_mm256_movemask_pd(in)) << j;
+        }
+        bits[begin / 64] = word;
+    }
+    if (begin < n) {
+        bits[begin / 64] = betweenWord(x + begin, n - begin, lo, hi);
+    }
+}
+
+__attribute__((target("avx2")))
+void selectBetweenAVX2(const int32_t* x, size_t n, int32_t lo, int32_t hi, uint64_t* bits) {
+    const __m256i vlo = _mm256_set1_epi32(lo), vhi = _mm256_set1_epi32(hi);
+    size_t begin = 0;
+    for (; begin + 64 <= n; begin += 64) {
+        uint64_t word = 0;
+        for (size_t j = 0; j < 64; j += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + begin + j));
+            __m256i out = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, v), _mm256_cmpgt_epi32(v, vhi));
+            uint64_t outside = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(out)));
+            word |= (~outside & 0xFFu) << j;
+        }
+        bits[begin / 64] = word;
+    }
+    if (begin < n) {
+        bits[begin / 64] = betweenWord(x + begin, n - begin, lo, hi);
+    }
+}
+
+__attribute__((target("avx512f")))
+void selectBetweenAVX512(const double* x, size_t n, double lo, double hi, uint64_t* bits) {
+    const __m512d vlo = _mm512_set1_pd(lo), vhi = _mm512_set1_pd(hi);
+    for (size_t begin = 0; begin < n; begin += 64) {
+        const size_t count = std::min<size_t>(64, n - begin);
+        uint64_t word = 0;
+        for (size_t j = 0; j < count; j += 8) {
+            __mmask8 k = static_cast<__mmask8>(count - j >= 8 ? 0xFF : (1u << (count - j)) - 1);
+            __m512d v = _mm512_maskz_loadu_pd(k, x + begin + j);
+            __mmask8 in = _mm512_mask_cmp_pd_mask(_mm512_mask_cmp_pd_mask(k, v, vlo, _CMP_GE_OQ), v, vhi, _CMP_LE_OQ);
+            word |= static_cast<uint64_t>(in) << j;
+        }
+        bits[begin / 64] = word;
+    }
+}
+
+__attribute__((target("avx512f")))
+void selectBetweenAVX512(const int32_t* x, size_t n, int32_t lo, int32_t hi, uint64_t* bits) {
+    const __m512i vlo = _mm512_set1_epi32(lo), vhi = _mm512_set1_epi32(hi);
+    for (size_t begin = 0; begin < n; begin += 64) {
+        const size_t count = std::min<size_t>(64, n - begin);
+        uint64_t word = 0;
+        for (size_t j = 0; j < count; j += 16) {
+            __mmask16 k = static_cast<__mmask16>(count - j >= 16 ? 0xFFFF : (1u << (count - j)) - 1);
+            __m512i v = _mm512_maskz_loadu_epi32(k, x + begin + j);
+            __mmask16 in = _mm512_mask_cmple_epi32_mask(_mm512_mask_cmpge_epi32_mask(k, v, vlo), v, vhi);
+            word |= static_cast<uint64_t>(in) << j;
+        }
+        bits[begin / 64] = word;
+    }
+}
+
+// Binning kernels: slots are computed as doubles with min/max and blends, then truncated
+
+__attribute__((target("avx2")))
+void binIndicesAVX2(const double* x, size_t n, double lo, double hi, uint32_t bins, uint32_t* slots) {
+    const __m256d vlo = _mm256_set1_pd(lo), vhi = _mm256_set1_pd(hi);
+    const __m256d scale = _mm256_set1_pd(bins / (hi - lo));
+    const __m256d last = _mm256_set1_pd(bins - 1.0), one = _mm256_set1_pd(1.0), zero = _mm256_setzero_pd();
+    const __m256d overflow = _mm256_set1_pd(bins + 1.0), nan = _mm256_set1_pd(bins + 2.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(x + i);
+        // min_pd returns its second operand when the first is NaN
+        __m256d t = _mm256_max_pd(_mm256_min_pd(_mm256_mul_pd(_mm256_sub_pd(v, vlo), scale), last), zero);
+        __m256d slot = _mm256_add_pd(_mm256_round_pd(t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), one);
+        slot = _mm256_blendv_pd(slot, zero, _mm256_cmp_pd(v, vlo, _CMP_LT_OQ));
+        slot = _mm256_blendv_pd(slot, overflow, _mm256_cmp_pd(v, vhi, _CMP_GT_OQ));
+        slot = _mm256_blendv_pd(slot, nan, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(slots + i), _mm256_cvttpd_epi32(slot));
+    }
+    // GCC omits vzeroupper before the tail call; without it the SSE code that
+    // follows (e.g. the std::log of logarithmic histograms) runs 20x slower
+    _mm256_zeroupper();
+    binIndicesScalar(x + i, n - i, lo, hi, bins, slots + i);
+}
+
+__attribute__((target("avx512f")))
+void binIndicesAVX512(const double* x, size_t n, double lo, double hi, uint32_t bins, uint32_t* slots) {
+    const __m512d vlo = _mm512_set1_pd(lo), vhi = _mm512_set1_pd(hi);
+    const __m512d scale = _mm512_set1_pd(bins / (hi - lo));
+    const __m512d last = _mm512_set1_pd(bins - 1.0), one = _mm512_set1_pd(1.0), zero = _mm512_setzero_pd();
+    const __m512d overflow = _mm512_set1_pd(bins + 1.0), nan = _mm512_set1_pd(bins + 2.0);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d v = _mm512_loadu_pd(x + i);
+        // Full-mask forms of min, max, round and convert (same results, explicit pass-through operand)
+        __m512d t = _mm512_mask_min_pd(zero, 0xFF, _mm512_mul_pd(_mm512_sub_pd(v, vlo), scale), last);
+        t = _mm512_mask_max_pd(zero, 0xFF, t, zero);
+        __m512d slot = _mm512_add_pd(_mm512_mask_roundscale_pd(zero, 0xFF, t, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), one);
+        slot = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(v, vlo, _CMP_LT_OQ), slot, zero);
+        slot = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(v, vhi, _CMP_GT_OQ), slot, overflow);
+        slot = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(v, v, _CMP_UNORD_Q), slot, nan);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(slots + i),
+                            _mm512_mask_cvttpd_epi32(_mm256_setzero_si256(), 0xFF, slot));
+    }
+    _mm256_zeroupper();
+    binIndicesScalar(x + i, n - i, lo, hi, bins, slots + i);
+}
+
+#endif // STATS_KERNELS_X86
+
+Isa detectIsa() {
+#ifdef STATS_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return Isa::AVX512;
+    if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+#endif
+    return Isa::Scalar;
+}
+
+std::atomic<Isa>& currentIsa() {
+    static std::atomic<Isa> isa{detectIsa()};
+    return isa;
+}
+
+} // namespace
+
+Isa activeIsa() {
+    return currentIsa().load(std::memory_order_relaxed);
+}
+
+bool isSupported(Isa isa) {
+    Isa best = detectIsa();
+    return static_cast<int>(isa) <= static_cast<int>(best);
+}
+
+void setIsa(Isa isa) {
+    if (!isSupported(isa)) {
+        throw std::invalid_argument(std::string("Instruction set not supported: ") + isaName(isa));
+    }
+    currentIsa().store(isa, std::memory_order_relaxed);
+}
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::AVX512: return "AVX-512";
+        case Isa::AVX2:   return "AVX2";
+        case Isa::Scalar: break;
+    }
+    return "scalar";
+}
+
+double sum(const double* x, size_t n) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: return sumAVX512(x, n);
+        case Isa::AVX2:   return sumAVX2(x, n);
+        case Isa::Scalar: break;
+    }
+#endif
+    return sumScalar(x, n);
+}
+
+double compensatedSum(const double* x, size_t n) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: return compensatedSumAVX512(x, n);
+        case Isa::AVX2:   return compensatedSumAVX2(x, n);
+        case Isa::Scalar: break;
+    }
+#endif
+    return compensatedSumScalar(x, n);
+}
+
+double sumSquaredDeviations(const double* x, size_t n, double center) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: return sumSquaredDeviationsAVX512(x, n, center);
+        case Isa::AVX2:   return sumSquaredDeviationsAVX2(x, n, center);
+        case Isa::Scalar: break;
+    }
+#endif
+    return sumSquaredDeviationsScalar(x, n, center);
+}
+
+void minMax(const double* x, size_t n, double& min, double& max) {
+    if (n == 0) {
+        min = max = std::numeric_limits<double>::quiet_NaN();
+        return;
+    }
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: minMaxAVX512(x, n, min, max); return;
+        case Isa::AVX2:   minMaxAVX2(x, n, min, max); return;
+        case Isa::Scalar: break;
+    }
+#endif
+    minMaxScalar(x, n, min, max);
+}
+
+void selectBetween(const double* x, size_t n, double lo, double hi, uint64_t* bits) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: selectBetweenAVX512(x, n, lo, hi, bits); return;
+        case Isa::AVX2:   selectBetweenAVX2(x, n, lo, hi, bits); return;
+        case Isa::Scalar: break;
+    }
+#endif
+    selectBetweenScalar(x, n, lo, hi, bits);
+}
+
+void selectBetween(const int32_t* x, size_t n, int32_t lo, int32_t hi, uint64_t* bits) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: selectBetweenAVX512(x, n, lo, hi, bits); return;
+        case Isa::AVX2:   selectBetweenAVX2(x, n, lo, hi, bits); return;
+        case Isa::Scalar: break;
+    }
+#endif
+    selectBetweenScalar(x, n, lo, hi, bits);
+}
+
+void binIndices(const double* x, size_t n, double lo, double hi, uint32_t bins, uint32_t* slots) {
+#ifdef STATS_KERNELS_X86
+    switch (activeIsa()) {
+        case Isa::AVX512: binIndicesAVX512(x, n, lo, hi, bins, slots); return;
+        case Isa::AVX2:   binIndicesAVX2(x, n, lo, hi, bins, slots); return;
+        case Isa::Scalar: break;
+    }
+#endif
+    binIndicesScalar(x, n, lo, hi, bins, slots);
+}
+
+} // namespace ScientificToolbox::Statistics::Kernels
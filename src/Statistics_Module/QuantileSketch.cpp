@@ -0,0 +1,256 @@
+#include "../../include/Statistics_Module/QuantileSketch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+constexpr uint32_t SKETCH_MAGIC = 0x4B4C4C31; // "KLL1"
+
+template <typename T>
+void writeRaw(std::string& out, const T& value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readRaw(const std::string& in, size_t& pos) {
+    if (pos + sizeof(T) > in.size()) {
+        throw std::runtime_error("Truncated quantile sketch");
+    }
+    T value;
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+} // namespace
+
+QuantileSketch::QuantileSketch(uint16_t k)
+    : capacity(k),
+      lo(std::numeric_limits<double>::infinity()),
+      hi(-std::numeric_limits<double>::infinity()),
+      levels(1) {
+    if (k < 8) {
+        throw std::invalid_argument("Quantile sketch parameter k must be at least 8");
+    }
+}
+
+size_t QuantileSketch::levelCapacity(size_t level) const {
+    // Capacities shrink geometrically (factor 2/3) going down from the top level
+    size_t depth = levels.size() - 1 - level;
+    double cap = std::ceil(capacity * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max<size_t>(2, static_cast<size_t>(cap));
+}
+
+size_t QuantileSketch::totalCapacity() const {
+    size_t total = 0;
+    for (size_t h = 0; h < levels.size(); ++h) {
+        total += levelCapacity(h);
+    }
+    return total;
+}
+
+size_t QuantileSketch::retained() const {
+    size_t total = 0;
+    for (const auto& level : levels) {
+        total += level.size();
+    }
+    return total;
+}
+
+bool QuantileSketch::coinFlip() {
+    // xorshift64*
+    rng ^= rng >> 12;
+    rng ^= rng << 25;
+    rng ^= rng >> 27;
+    return ((rng * 0x2545F4914F6CDD1DULL) >> 63) != 0;
+}
+
+void QuantileSketch::compress() {
+    while (retained() > totalCapacity()) {
+        size_t h = 0;
+        while (levels[h].size() < levelCapacity(h)) {
+            ++h;
+        }
+        if (h + 1 == levels.size()) {
+            levels.emplace_back();
+        }
+
+        auto& level = levels[h];
+        std::sort(level.begin(), level.end());
+        // An odd item stays behind so the promoted items come in pairs
+        double leftover = 0.0;
+        bool odd = level.size() % 2 == 1;
+        if (odd) {
+            leftover = level.back();
+            level.pop_back();
+        }
+        size_t offset = coinFlip() ? 1 : 0;
+        auto& next = levels[h + 1];
+        for (size_t i = offset; i < level.size(); i += 2) {
+            next.push_back(level[i]);
+        }
+        level.clear();
+        if (odd) {
+            level.push_back(leftover);
+        }
+    }
+}
+
+void QuantileSketch::update(double value) {
+    if (std::isnan(value)) {
+        return;
+    }
+    ++n;
+    lo = std::min(lo, value);
+    hi = std::max(hi, value);
+    levels[0].push_back(value);
+    if (levels[0].size() >= levelCapacity(0)) {
+        compress();
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.capacity != capacity) {
+        throw std::invalid_argument("Cannot merge quantile sketches with different k");
+    }
+    if (other.n == 0) {
+        return;
+    }
+    if (levels.size() < other.levels.size()) {
+        levels.resize(other.levels.size());
+    }
+    for (size_t h = 0; h < other.levels.size(); ++h) {
+        levels[h].insert(levels[h].end(), other.levels[h].begin(), other.levels[h].end());
+    }
+    n += other.n;
+    lo = std::min(lo, other.lo);
+    hi = std::max(hi, other.hi);
+    compress();
+}
+
+double QuantileSketch::min() const {
+    if (n == 0) throw std::runtime_error("Quantile sketch is empty");
+    return lo;
+}
+
+double QuantileSketch::max() const {
+    if (n == 0) throw std::runtime_error("Quantile sketch is empty");
+    return hi;
+}
+
+std::vector<std::pair<double, uint64_t>> QuantileSketch::weightedItems() const {
+    std::vector<std::pair<double, uint64_t>> items;
+    items.reserve(retained());
+    for (size_t h = 0; h < levels.size(); ++h) {
+        for (double v : levels[h]) {
+            items.emplace_back(v, uint64_t{1} << h);
+        }
+    }
+    std::sort(items.begin(), items.end());
+    return items;
+}
+
+std::vector<double> QuantileSketch::quantiles(const std::vector<double>& probabilities) const {
+    if (n == 0) {
+        throw std::runtime_error("Quantile sketch is empty");
+    }
+    auto items = weightedItems();
+    uint64_t total = 0;
+    for (const auto& item : items) {
+        total += item.second;
+    }
+
+    std::vector<double> result;
+    result.reserve(probabilities.size());
+    for (double p : probabilities) {
+        if (!(p >= 0.0 && p <= 1.0)) {
+            throw std::invalid_argument("Quantile probabilities must be in [0, 1]");
+        }
+        if (p == 0.0) { result.push_back(lo); continue; }
+        if (p == 1.0) { result.push_back(hi); continue; }
+        double target = p * static_cast<double>(total);
+        uint64_t cumulative = 0;
+        double value = hi;
+        for (const auto& [v, w] : items) {
+            cumulative += w;
+            if (static_cast<double>(cumulative) >= target) {
+                value = v;
+                break;
+            }
+        }
+        result.push_back(value);
+    }
+    return result;
+}
+
+double QuantileSketch::quantile(double probability) const {
+    return quantiles({probability}).front();
+}
+
+double QuantileSketch::rank(double value) const {
+    if (n == 0) {
+        throw std::runtime_error("Quantile sketch is empty");
+    }
+    uint64_t below = 0;
+    uint64_t total = 0;
+    for (size_t h = 0; h < levels.size(); ++h) {
+        for (double v : levels[h]) {
+            total += uint64_t{1} << h;
+            if (v <= value) below += uint64_t{1} << h;
+        }
+    }
+    return static_cast<double>(below) / static_cast<double>(total);
+}
+
+std::string QuantileSketch::serialize() const {
+    std::string out;
+    out.reserve(32 + 8 * levels.size() + 8 * retained());
+    writeRaw(out, SKETCH_MAGIC);
+    writeRaw(out, capacity);
+    writeRaw(out, n);
+    writeRaw(out, lo);
+    writeRaw(out, hi);
+    writeRaw(out, rng);
+    writeRaw(out, static_cast<uint32_t>(levels.size()));
+    for (const auto& level : levels) {
+        writeRaw(out, static_cast<uint32_t>(level.size()));
+        out.append(reinterpret_cast<const char*>(level.data()), level.size() * sizeof(double));
+    }
+    return out;
+}
+
+QuantileSketch QuantileSketch::deserialize(const std::string& bytes) {
+    size_t pos = 0;
+    if (readRaw<uint32_t>(bytes, pos) != SKETCH_MAGIC) {
+        throw std::runtime_error("Not a serialized quantile sketch");
+    }
+    QuantileSketch sketch(readRaw<uint16_t>(bytes, pos));
+    sketch.n = readRaw<uint64_t>(bytes, pos);
+    sketch.lo = readRaw<double>(bytes, pos);
+    sketch.hi = readRaw<double>(bytes, pos);
+    sketch.rng = readRaw<uint64_t>(bytes, pos);
+    uint32_t count = readRaw<uint32_t>(bytes, pos);
+    if (count == 0 || count > 64) {
+        throw std::runtime_error("Corrupted quantile sketch");
+    }
+    sketch.levels.assign(count, {});
+    for (auto& level : sketch.levels) {
+        uint32_t size = readRaw<uint32_t>(bytes, pos);
+        if (pos + size * sizeof(double) > bytes.size()) {
+            throw std::runtime_error("Truncated quantile sketch");
+        }
+        level.resize(size);
+        if (size > 0) {
+            std::memcpy(level.data(), bytes.data() + pos, size * sizeof(double));
+        }
+        pos += size * sizeof(double);
+    }
+    return sketch;
+}
+
+} // namespace ScientificToolbox::Statistics
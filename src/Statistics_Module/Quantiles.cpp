@@ -0,0 +1,74 @@
+#include "../../include/Statistics_Module/Quantiles.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/**
+ * @brief Places every rank of ranks[first, last) at its sorted position within data[lo, hi)
+ */
+template <typename T>
+void multiSelect(std::vector<T>& data, size_t lo, size_t hi,
+                 const std::vector<size_t>& ranks, size_t first, size_t last) {
+    if (first >= last || lo >= hi) {
+        return;
+    }
+    size_t mid = first + (last - first) / 2;
+    size_t rank = ranks[mid];
+    std::nth_element(data.begin() + lo, data.begin() + rank, data.begin() + hi);
+    multiSelect(data, lo, rank, ranks, first, mid);
+    multiSelect(data, rank + 1, hi, ranks, mid + 1, last);
+}
+
+} // namespace
+
+template <typename T>
+std::vector<double> quantilesInPlace(std::vector<T>& data, const std::vector<double>& probabilities) {
+    if (data.empty()) {
+        throw std::invalid_argument("Cannot compute quantiles of an empty column");
+    }
+    const size_t n = data.size();
+
+    // Order statistics needed: floor(h) and the next one for the interpolation
+    std::vector<size_t> ranks;
+    ranks.reserve(2 * probabilities.size());
+    for (double p : probabilities) {
+        if (!(p >= 0.0 && p <= 1.0)) {
+            throw std::invalid_argument("Quantile probabilities must be in [0, 1]");
+        }
+        size_t below = static_cast<size_t>(std::floor(p * static_cast<double>(n - 1)));
+        ranks.push_back(below);
+        ranks.push_back(std::min(below + 1, n - 1));
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+    multiSelect(data, 0, n, ranks, 0, ranks.size());
+
+    std::vector<double> result;
+    result.reserve(probabilities.size());
+    for (double p : probabilities) {
+        double h = p * static_cast<double>(n - 1);
+        size_t below = static_cast<size_t>(std::floor(h));
+        size_t above = std::min(below + 1, n - 1);
+        double lower = static_cast<double>(data[below]);
+        double upper = static_cast<double>(data[above]);
+        result.push_back(lower + (h - static_cast<double>(below)) * (upper - lower));
+    }
+    return result;
+}
+
+template <typename T>
+double quantileInPlace(std::vector<T>& data, double probability) {
+    return quantilesInPlace(data, std::vector<double>{probability}).front();
+}
+
+template std::vector<double> quantilesInPlace<int>(std::vector<int>&, const std::vector<double>&);
+template std::vector<double> quantilesInPlace<double>(std::vector<double>&, const std::vector<double>&);
+template double quantileInPlace<int>(std::vector<int>&, double);
+template double quantileInPlace<double>(std::vector<double>&, double);
+
+} // namespace ScientificToolbox::Statistics
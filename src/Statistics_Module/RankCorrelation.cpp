@@ -0,0 +1,134 @@
+#include "../../include/Statistics_Module/RankCorrelation.hpp"
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/**
+ * @brief Sorts a sequence with a bottom-up merge sort and counts its inversions
+ * @param seq Sequence to sort in place
+ * @return Number of pairs i < j with seq[i] > seq[j]
+ */
+uint64_t countInversions(std::vector<uint32_t>& seq) {
+    const size_t n = seq.size();
+    std::vector<uint32_t> buffer(n);
+    uint64_t inversions = 0;
+    for (size_t width = 1; width < n; width *= 2) {
+        for (size_t lo = 0; lo < n; lo += 2 * width) {
+            const size_t mid = std::min(lo + width, n);
+            const size_t hi = std::min(lo + 2 * width, n);
+            size_t i = lo, j = mid, out = lo;
+            while (i < mid && j < hi) {
+                if (seq[j] < seq[i]) {
+                    // seq[j] jumps over every remaining element of the left run
+                    inversions += mid - i;
+                    buffer[out++] = seq[j++];
+                } else {
+                    buffer[out++] = seq[i++];
+                }
+            }
+            std::copy(seq.begin() + i, seq.begin() + mid, buffer.begin() + out);
+            std::copy(seq.begin() + j, seq.begin() + hi, buffer.begin() + out + (mid - i));
+        }
+        seq.swap(buffer);
+    }
+    return inversions;
+}
+
+double pairsOf(double t) {
+    return t * (t - 1.0) / 2.0;
+}
+
+} // namespace
+
+RankedColumn::RankedColumn(const std::vector<double>& values) {
+    const size_t n = values.size();
+    order_.resize(n);
+    std::iota(order_.begin(), order_.end(), 0u);
+    std::stable_sort(order_.begin(), order_.end(),
+                     [&values](uint32_t a, uint32_t b) { return values[a] < values[b]; });
+
+    centered_.resize(n);
+    dense_.resize(n);
+    const double center = (static_cast<double>(n) + 1.0) / 2.0;
+    uint32_t rank = 0;
+    for (size_t start = 0; start < n;) {
+        size_t end = start + 1;
+        while (end < n && values[order_[end]] == values[order_[start]]) {
+            ++end;
+        }
+        // Positions start..end-1 hold ranks start+1..end, whose mean is (start + end + 1) / 2
+        const double average = (static_cast<double>(start) + static_cast<double>(end) + 1.0) / 2.0;
+        for (size_t p = start; p < end; ++p) {
+            centered_[order_[p]] = average - center;
+            dense_[order_[p]] = rank;
+        }
+        sumSquares_ += static_cast<double>(end - start) * (average - center) * (average - center);
+        tiedPairs_ += pairsOf(static_cast<double>(end - start));
+        ++rank;
+        start = end;
+    }
+}
+
+double spearmanCorrelation(const RankedColumn& x, const RankedColumn& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Rank correlation needs the same number of observations");
+    }
+    const auto n = static_cast<Eigen::Index>(x.size());
+    Eigen::Map<const Eigen::VectorXd> a(x.centeredRanks().data(), n);
+    Eigen::Map<const Eigen::VectorXd> b(y.centeredRanks().data(), n);
+    return a.dot(b) / std::sqrt(x.rankSumSquares() * y.rankSumSquares());
+}
+
+double kendallTau(const RankedColumn& x, const RankedColumn& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Rank correlation needs the same number of observations");
+    }
+    const size_t n = x.size();
+    const auto& order = x.order();
+    const auto& xr = x.denseRanks();
+    const auto& yr = y.denseRanks();
+
+    // y ranks in (x, y) order: x order is precomputed, only runs of tied x
+    // need sorting by y. Joint ties are counted on the way.
+    std::vector<uint32_t> seq(n);
+    double jointTies = 0.0;
+    for (size_t start = 0; start < n;) {
+        size_t end = start;
+        while (end < n && xr[order[end]] == xr[order[start]]) {
+            seq[end] = yr[order[end]];
+            ++end;
+        }
+        if (end - start > 1) {
+            std::sort(seq.begin() + start, seq.begin() + end);
+            for (size_t p = start; p < end;) {
+                size_t q = p + 1;
+                while (q < end && seq[q] == seq[p]) ++q;
+                jointTies += pairsOf(static_cast<double>(q - p));
+                p = q;
+            }
+        }
+        start = end;
+    }
+
+    const double swaps = static_cast<double>(countInversions(seq));
+    const double n0 = pairsOf(static_cast<double>(n));
+    const double n1 = x.tiedPairs();
+    const double n2 = y.tiedPairs();
+    return (n0 - n1 - n2 + jointTies - 2.0 * swaps) / std::sqrt((n0 - n1) * (n0 - n2));
+}
+
+double spearmanCorrelation(const std::vector<double>& x, const std::vector<double>& y) {
+    return spearmanCorrelation(RankedColumn(x), RankedColumn(y));
+}
+
+double kendallTau(const std::vector<double>& x, const std::vector<double>& y) {
+    return kendallTau(RankedColumn(x), RankedColumn(y));
+}
+
+} // namespace ScientificToolbox::Statistics
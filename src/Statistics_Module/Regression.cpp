@@ -0,0 +1,136 @@
+#include "../../include/Statistics_Module/Regression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/// Below this reciprocal condition number the Cholesky solution is replaced by QR
+constexpr double kMinReciprocalCondition = 1e-12;
+
+} // namespace
+
+LinearRegression::LinearRegression(size_t predictors)
+    : moments(predictors + 1) {
+    if (predictors == 0) {
+        throw std::invalid_argument("A regression needs at least one predictor");
+    }
+}
+
+LinearRegression::LinearRegression(CoMoments acc)
+    : moments(std::move(acc)) {
+    if (moments.dims() < 2) {
+        throw std::invalid_argument("A regression needs at least one predictor");
+    }
+}
+
+void LinearRegression::push(const Eigen::Ref<const Eigen::VectorXd>& x, double y) {
+    if (static_cast<size_t>(x.size()) != predictors()) {
+        throw std::invalid_argument("Observation size does not match the number of predictors");
+    }
+    if (x.array().isNaN().any() || std::isnan(y)) {
+        return;
+    }
+    Eigen::VectorXd row(x.size() + 1);
+    row << x, y;
+    moments.push(row);
+}
+
+void LinearRegression::pushBlock(const Eigen::Ref<const Eigen::MatrixXd>& rows) {
+    if (static_cast<size_t>(rows.cols()) != moments.dims()) {
+        throw std::invalid_argument("Block width does not match the number of predictors plus the response");
+    }
+    if (!rows.array().isNaN().any()) {
+        moments.pushBlock(rows);
+        return;
+    }
+    Eigen::MatrixXd complete(rows.rows(), rows.cols());
+    Eigen::Index kept = 0;
+    for (Eigen::Index i = 0; i < rows.rows(); ++i) {
+        if (!rows.row(i).array().isNaN().any()) {
+            complete.row(kept++) = rows.row(i);
+        }
+    }
+    moments.pushBlock(complete.topRows(kept));
+}
+
+void LinearRegression::merge(const LinearRegression& other) {
+    if (other.moments.dims() != moments.dims()) {
+        throw std::invalid_argument("Cannot merge regressions over different numbers of predictors");
+    }
+    moments.merge(other.moments);
+}
+
+RegressionResult LinearRegression::fit(double ridge, bool intercept) const {
+    if (!(ridge >= 0.0 && std::isfinite(ridge))) {
+        throw std::invalid_argument("Ridge penalty must be finite and non-negative");
+    }
+    const size_t p = predictors();
+    const size_t n = count();
+    const size_t fitted = p + (intercept ? 1 : 0);
+    if (n <= fitted) {
+        throw std::runtime_error("A regression needs more complete rows than fitted parameters");
+    }
+    const auto pIndex = static_cast<Eigen::Index>(p);
+    const double rows = static_cast<double>(n);
+
+    // Centered sums with an intercept, raw cross products X^T X, X^T y without
+    Eigen::MatrixXd s = moments.comoments();
+    if (!intercept) {
+        s.selfadjointView<Eigen::Upper>().rankUpdate(moments.mean(), rows);
+        s.triangularView<Eigen::StrictlyLower>() = s.transpose();
+    }
+    const Eigen::MatrixXd sxx = s.topLeftCorner(pIndex, pIndex);
+    const Eigen::VectorXd sxy = s.topRightCorner(pIndex, 1);
+    const double syy = s(pIndex, pIndex);
+
+    // Scaling to a unit diagonal removes the conditioning due to the units of the predictors
+    Eigen::MatrixXd a = sxx;
+    a.diagonal().array() += ridge;
+    if ((a.diagonal().array() <= 0.0).any()) {
+        throw std::runtime_error("Predictors are collinear: the regression has no unique solution");
+    }
+    const Eigen::VectorXd scale = a.diagonal().cwiseSqrt().cwiseInverse();
+    const Eigen::MatrixXd scaled = scale.asDiagonal() * a * scale.asDiagonal();
+    const Eigen::MatrixXd identity = Eigen::MatrixXd::Identity(pIndex, pIndex);
+    Eigen::MatrixXd inverse;
+    Eigen::LLT<Eigen::MatrixXd> llt(scaled);
+    if (llt.info() == Eigen::Success && llt.rcond() > kMinReciprocalCondition) {
+        inverse = llt.solve(identity);
+    } else {
+        Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(scaled);
+        if (qr.rank() < pIndex) {
+            throw std::runtime_error("Predictors are collinear: the regression has no unique solution");
+        }
+        inverse = qr.solve(identity);
+    }
+    inverse = scale.asDiagonal() * inverse * scale.asDiagonal();
+
+    RegressionResult result;
+    result.ridge = ridge;
+    result.observations = n;
+    result.coefficients = inverse * sxy;
+    const Eigen::VectorXd& b = result.coefficients;
+    const double rss = std::max(0.0, syy - 2.0 * b.dot(sxy) + b.dot(sxx * b));
+    const double dof = static_cast<double>(n - fitted);
+    const double sigma2 = rss / dof;
+    // Sandwich form: reduces to sigma^2 (X^T X)^-1 without ridge penalty
+    const Eigen::MatrixXd covariance = sigma2 * inverse * sxx * inverse;
+    result.standardErrors = covariance.diagonal().cwiseMax(0.0).cwiseSqrt();
+    result.residualStandardError = std::sqrt(sigma2);
+    result.rSquared = 1.0 - rss / syy;
+    result.adjustedRSquared = 1.0 - (1.0 - result.rSquared) * (rows - (intercept ? 1.0 : 0.0)) / dof;
+    if (intercept) {
+        const Eigen::VectorXd mx = moments.mean().head(pIndex);
+        result.intercept = moments.mean()(pIndex) - mx.dot(b);
+        result.interceptStandardError = std::sqrt(sigma2 / rows + mx.dot(covariance * mx));
+    } else {
+        result.interceptStandardError = std::numeric_limits<double>::quiet_NaN();
+    }
+    return result;
+}
+
+} // namespace ScientificToolbox::Statistics
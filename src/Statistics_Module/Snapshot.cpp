@@ -0,0 +1,363 @@
+#include "../../include/Statistics_Module/Dataset.hpp"
+#include "../../include/Utilities.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+/*
+ * Snapshot layout (host byte order, every block aligned to kAlignment bytes):
+ *
+ *   FileHeader
+ *   ColumnEntry[columns]
+ *   per column: name, validity bitmap, values, [dictionary offsets, dictionary chars]
+ *
+ * Values are int32_t (Int), double (Double) or uint32_t codes (String), one
+ * per row. Mixed columns store one double and one tag byte per row: the tag
+ * says whether the double is an int, a double or a dictionary code.
+ */
+constexpr char kMagic[8] = {'S', 'T', 'B', 'X', 'S', 'N', 'A', 'P'};
+constexpr uint32_t kVersion = 1;
+constexpr uint64_t kByteOrderMark = 0x0102030405060708ULL;
+constexpr uint64_t kAlignment = 64;
+
+enum MixedTag : uint8_t { kTagInt = 0, kTagDouble = 1, kTagString = 2 };
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t columns;
+    uint64_t rows;
+    uint64_t byteOrderMark;
+    uint64_t directoryOffset;
+};
+
+struct ColumnEntry {
+    uint32_t type;
+    uint32_t nameLength;
+    uint64_t nameOffset;
+    uint64_t count;
+    uint64_t nullCount;
+    double min;
+    double max;
+    uint64_t validityOffset;
+    uint64_t valuesOffset;
+    uint64_t tagsOffset;
+    uint64_t dictionarySize;
+    uint64_t dictionaryOffsetsOffset;
+    uint64_t dictionaryCharsOffset;
+    uint64_t dictionaryCharsBytes;
+};
+
+/**
+ * @brief Appends aligned blocks to the snapshot file, tracking their offsets
+ */
+class BlockWriter {
+public:
+    explicit BlockWriter(const std::string& filename) : out_(filename, std::ios::binary | std::ios::trunc) {
+        if (!out_.is_open()) {
+            throw std::runtime_error("Could not open snapshot file for writing: " + filename);
+        }
+    }
+
+    /// Writes bytes at the next aligned offset and returns that offset
+    uint64_t write(const void* data, uint64_t bytes) {
+        static const char zeros[kAlignment] = {};
+        const uint64_t padding = (kAlignment - position_ % kAlignment) % kAlignment;
+        out_.write(zeros, static_cast<std::streamsize>(padding));
+        const uint64_t offset = position_ + padding;
+        if (bytes > 0) {
+            out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        }
+        position_ = offset + bytes;
+        return offset;
+    }
+
+    void writeAt(uint64_t offset, const void* data, uint64_t bytes) {
+        out_.seekp(static_cast<std::streamoff>(offset));
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        out_.seekp(static_cast<std::streamoff>(position_));
+    }
+
+    void finish(const std::string& filename) {
+        out_.close();
+        if (out_.fail()) {
+            throw std::runtime_error("Could not write snapshot file: " + filename);
+        }
+    }
+
+private:
+    std::ofstream out_;
+    uint64_t position_ = 0;
+};
+
+void writeDictionary(BlockWriter& writer, const StringPool& dictionary, ColumnEntry& entry) {
+    entry.dictionarySize = dictionary.size();
+    entry.dictionaryOffsetsOffset = writer.write(dictionary.offsets(), (dictionary.size() + 1) * sizeof(uint64_t));
+    entry.dictionaryCharsBytes = dictionary.chars().size();
+    entry.dictionaryCharsOffset = writer.write(dictionary.chars().data(), dictionary.chars().size());
+}
+
+template <typename T>
+void numericRange(const ColumnView<T>& view, ColumnEntry& entry) {
+    double lo = std::numeric_limits<double>::infinity();
+    double hi = -lo;
+    for (size_t i = 0; i < view.size(); ++i) {
+        if (view.isValid(i)) {
+            const auto x = static_cast<double>(view[i]);
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+        }
+    }
+    if (lo <= hi) {
+        entry.min = lo;
+        entry.max = hi;
+    }
+}
+
+/**
+ * @brief Bounds-checked access to the blocks of a mapped snapshot
+ */
+class SnapshotReader {
+public:
+    explicit SnapshotReader(const std::string& filename) : file_(std::make_shared<MappedFile>(filename)) {
+        if (file_->size() < sizeof(FileHeader)) {
+            throw std::runtime_error("Not a snapshot file: " + filename);
+        }
+        std::memcpy(&header_, file_->data(), sizeof(FileHeader));
+        if (std::memcmp(header_.magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("Not a snapshot file: " + filename);
+        }
+        if (header_.version != kVersion || header_.byteOrderMark != kByteOrderMark) {
+            throw std::runtime_error("Unsupported snapshot version or byte order: " + filename);
+        }
+        const char* directory = block<char>(header_.directoryOffset, uint64_t{header_.columns} * sizeof(ColumnEntry));
+        entries_.resize(header_.columns);
+        if (header_.columns > 0) {
+            std::memcpy(entries_.data(), directory, entries_.size() * sizeof(ColumnEntry));
+        }
+    }
+
+    const FileHeader& header() const { return header_; }
+    const std::vector<ColumnEntry>& entries() const { return entries_; }
+    const std::shared_ptr<MappedFile>& file() const { return file_; }
+
+    /// Pointer to count elements of T at offset, after checking bounds and alignment
+    template <typename T>
+    const T* block(uint64_t offset, uint64_t count) const {
+        if (count > (std::numeric_limits<uint64_t>::max() - offset) / sizeof(T) ||
+            offset + count * sizeof(T) > file_->size() || offset % alignof(T) != 0) {
+            throw std::runtime_error("Corrupted snapshot file: block out of bounds");
+        }
+        return reinterpret_cast<const T*>(file_->data() + offset);
+    }
+
+    template <typename T>
+    Buffer<T> borrow(uint64_t offset, uint64_t count) const {
+        return Buffer<T>(block<T>(offset, count), count, file_);
+    }
+
+    std::string name(const ColumnEntry& entry) const {
+        return std::string(block<char>(entry.nameOffset, entry.nameLength), entry.nameLength);
+    }
+
+    StringPool dictionary(const ColumnEntry& entry) const {
+        const auto* offsets = block<uint64_t>(entry.dictionaryOffsetsOffset, entry.dictionarySize + 1);
+        const auto* chars = block<char>(entry.dictionaryCharsOffset, entry.dictionaryCharsBytes);
+        try {
+            return StringPool::fromArena(std::string_view(chars, entry.dictionaryCharsBytes), offsets,
+                                         entry.dictionarySize);
+        } catch (const std::invalid_argument& e) {
+            throw std::runtime_error(std::string("Corrupted snapshot file: ") + e.what());
+        }
+    }
+
+private:
+    std::shared_ptr<MappedFile> file_;
+    FileHeader header_{};
+    std::vector<ColumnEntry> entries_;
+};
+
+Column readColumn(const SnapshotReader& reader, const ColumnEntry& entry, size_t rows) {
+    const uint64_t words = (rows + 63) / 64;
+    auto validity = reader.borrow<uint64_t>(entry.validityOffset, words);
+    if (entry.nullCount > rows) {
+        throw std::runtime_error("Corrupted snapshot file: null count exceeds the number of rows");
+    }
+    switch (static_cast<ColumnType>(entry.type)) {
+        case ColumnType::Int:
+            return Column::fromBuffers(reader.borrow<int32_t>(entry.valuesOffset, rows), validity, entry.nullCount);
+        case ColumnType::Double:
+            return Column::fromBuffers(reader.borrow<double>(entry.valuesOffset, rows), validity, entry.nullCount);
+        case ColumnType::String:
+            return Column::fromBuffers(reader.borrow<uint32_t>(entry.valuesOffset, rows), validity, entry.nullCount,
+                                       reader.dictionary(entry));
+        case ColumnType::Mixed: {
+            const auto* values = reader.block<double>(entry.valuesOffset, rows);
+            const auto* tags = reader.block<uint8_t>(entry.tagsOffset, rows);
+            StringPool dictionary = reader.dictionary(entry);
+            Column column;
+            column.reserve(rows);
+            for (size_t i = 0; i < rows; ++i) {
+                if (!((validity[i >> 6] >> (i & 63)) & 1u)) {
+                    column.append(OptionalDataValue());
+                } else if (tags[i] == kTagInt) {
+                    column.append(DataValue(static_cast<int>(values[i])));
+                } else if (tags[i] == kTagDouble) {
+                    column.append(DataValue(values[i]));
+                } else {
+                    const auto code = static_cast<uint32_t>(values[i]);
+                    if (code >= dictionary.size()) {
+                        throw std::runtime_error("Corrupted snapshot file: string code out of range");
+                    }
+                    column.append(DataValue(std::string(dictionary[code])));
+                }
+            }
+            return column;
+        }
+        case ColumnType::Empty: {
+            Column column;
+            for (size_t i = 0; i < rows; ++i) {
+                column.appendNull();
+            }
+            return column;
+        }
+    }
+    throw std::runtime_error("Corrupted snapshot file: unknown column type");
+}
+
+} // namespace
+
+void Dataset::save(const std::string& filename) const {
+    BlockWriter writer(filename);
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.columns = static_cast<uint32_t>(columns.size());
+    header.rows = rows;
+    header.byteOrderMark = kByteOrderMark;
+    writer.write(&header, sizeof(header));
+
+    std::vector<ColumnEntry> entries(columns.size());
+    header.directoryOffset = writer.write(entries.data(), entries.size() * sizeof(ColumnEntry));
+
+    const uint64_t words = (rows + 63) / 64;
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const Column& column = columns[c];
+        ColumnEntry& entry = entries[c];
+        entry.type = static_cast<uint32_t>(column.type());
+        entry.nameLength = static_cast<uint32_t>(names[c].size());
+        entry.nameOffset = writer.write(names[c].data(), names[c].size());
+        entry.count = column.size() - column.nullCount();
+        entry.nullCount = column.nullCount();
+        entry.min = entry.max = std::numeric_limits<double>::quiet_NaN();
+
+        switch (column.type()) {
+            case ColumnType::Int: {
+                auto view = column.view<int32_t>();
+                numericRange(view, entry);
+                entry.validityOffset = writer.write(view.validity(), words * sizeof(uint64_t));
+                entry.valuesOffset = writer.write(view.data(), rows * sizeof(int32_t));
+                break;
+            }
+            case ColumnType::Double: {
+                auto view = column.view<double>();
+                numericRange(view, entry);
+                entry.validityOffset = writer.write(view.validity(), words * sizeof(uint64_t));
+                entry.valuesOffset = writer.write(view.data(), rows * sizeof(double));
+                break;
+            }
+            case ColumnType::String: {
+                auto view = column.view<uint32_t>();
+                entry.validityOffset = writer.write(view.validity(), words * sizeof(uint64_t));
+                entry.valuesOffset = writer.write(view.data(), rows * sizeof(uint32_t));
+                writeDictionary(writer, column.dictionary(), entry);
+                break;
+            }
+            case ColumnType::Empty: {
+                std::vector<uint64_t> validity(words, 0);
+                entry.validityOffset = writer.write(validity.data(), words * sizeof(uint64_t));
+                break;
+            }
+            case ColumnType::Mixed: {
+                std::vector<uint64_t> validity(words, 0);
+                std::vector<double> values(rows, 0.0);
+                std::vector<uint8_t> tags(rows, kTagInt);
+                StringPool dictionary;
+                for (size_t i = 0; i < rows; ++i) {
+                    auto value = column.at(i);
+                    if (!value) continue;
+                    validity[i >> 6] |= uint64_t{1} << (i & 63);
+                    if (const auto* s = std::get_if<std::string>(&*value)) {
+                        tags[i] = kTagString;
+                        values[i] = dictionary.intern(*s);
+                    } else {
+                        tags[i] = std::holds_alternative<int>(*value) ? kTagInt : kTagDouble;
+                        values[i] = std::holds_alternative<int>(*value) ? std::get<int>(*value)
+                                                                        : std::get<double>(*value);
+                        entry.min = std::isnan(entry.min) ? values[i] : std::min(entry.min, values[i]);
+                        entry.max = std::isnan(entry.max) ? values[i] : std::max(entry.max, values[i]);
+                    }
+                }
+                entry.validityOffset = writer.write(validity.data(), words * sizeof(uint64_t));
+                entry.valuesOffset = writer.write(values.data(), rows * sizeof(double));
+                entry.tagsOffset = writer.write(tags.data(), rows);
+                writeDictionary(writer, dictionary, entry);
+                break;
+            }
+        }
+    }
+    writer.writeAt(0, &header, sizeof(header));
+    writer.writeAt(header.directoryOffset, entries.data(), entries.size() * sizeof(ColumnEntry));
+    writer.finish(filename);
+}
+
+Dataset Dataset::fromSnapshot(const std::string& filename) {
+    SnapshotReader reader(filename);
+    Dataset ds;
+    const size_t rows = reader.header().rows;
+    std::vector<std::string> columnNames;
+    for (const auto& entry : reader.entries()) {
+        columnNames.push_back(reader.name(entry));
+    }
+    ds.initSchema(columnNames);
+    for (size_t c = 0; c < columnNames.size(); ++c) {
+        ds.columns[c] = readColumn(reader, reader.entries()[c], rows);
+    }
+    ds.rows = columnNames.empty() ? 0 : rows;
+    return ds;
+}
+
+std::vector<SnapshotColumn> Dataset::snapshotSchema(const std::string& filename) {
+    SnapshotReader reader(filename);
+    std::vector<SnapshotColumn> schema;
+    for (const auto& entry : reader.entries()) {
+        SnapshotColumn column;
+        column.name = reader.name(entry);
+        column.type = static_cast<ColumnType>(entry.type);
+        column.count = entry.count;
+        column.nullCount = entry.nullCount;
+        column.min = entry.min;
+        column.max = entry.max;
+        schema.push_back(std::move(column));
+    }
+    return schema;
+}
+
+bool Dataset::isSnapshot(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    char magic[sizeof(kMagic)] = {};
+    return in.read(magic, sizeof(magic)) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+Dataset Dataset::load(const std::string& filename, unsigned threads, const ImportOptions& options) {
+    return isSnapshot(filename) ? fromSnapshot(filename) : fromCSV(filename, threads, options);
+}
+
+} // namespace ScientificToolbox::Statistics
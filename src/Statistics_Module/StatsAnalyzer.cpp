@@ -1,16 +1,778 @@
 #include "../../include/Statistics_Module/Statistical_analyzer.hpp"
+#include "../../include/Statistics_Module/Kernels.hpp"
 #include <numeric>
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <limits>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
 
 namespace ScientificToolbox::Statistics {
 
+namespace {
+
+/**
+ * @brief Calls f(value) for every non-null numeric value of a column, without copying it
+ * @throws std::runtime_error if the column holds strings
+ */
+template <typename F>
+void forEachNumeric(const Column& column, F&& f) {
+    switch (column.type()) {
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            for (size_t i = 0; i < view.size(); ++i) {
+                if (view.isValid(i)) f(static_cast<double>(view[i]));
+            }
+            break;
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            for (size_t i = 0; i < view.size(); ++i) {
+                if (view.isValid(i)) f(view[i]);
+            }
+            break;
+        }
+        case ColumnType::Empty:
+            break;
+        default:
+            throw std::runtime_error("Column is not numeric");
+    }
+}
+
+/**
+ * @brief Contiguous non-null doubles of a column for the reduction kernels
+ * 
+ * A Double column without nulls is borrowed as is; any other column is
+ * extracted with Dataset::getColumn<double>, which also reports missing or
+ * non-numeric columns.
+ */
+class NumericBuffer {
+public:
+    NumericBuffer(const Dataset& dataset, const std::string& name) {
+        const Column& column = dataset.column(name);
+        if (column.type() == ColumnType::Double && column.nullCount() == 0 && column.size() > 0) {
+            auto view = column.view<double>();
+            data_ = view.data();
+            size_ = view.size();
+        } else {
+            owned_ = dataset.getColumn<double>(name);
+            data_ = owned_.data();
+            size_ = owned_.size();
+        }
+    }
+
+    const double* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /// Mutable copy of the values, for algorithms that reorder them
+    std::vector<double> release() {
+        if (owned_.empty()) {
+            return std::vector<double>(data_, data_ + size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        return std::move(owned_);
+    }
+
+private:
+    std::vector<double> owned_;
+    const double* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * Values per chunk of the chunked reductions. The size is fixed, so the partial
+ * results and the order they are combined in depend only on the data, never on
+ * the number of threads.
+ */
+constexpr size_t kChunkSize = size_t{1} << 16;
+
+size_t chunkCount(size_t n) {
+    return (n + kChunkSize - 1) / kChunkSize;
+}
+
+/**
+ * @brief Non-null numeric values of the rows [begin, size) of a column, packed
+ * 
+ * Borrows the buffer of a Double column without nulls; other columns are
+ * copied with the conversions of Column::values<double>. Cached chunks end on
+ * multiples of kChunkSize values, and rowAfter maps such a prefix back to
+ * the row where the next chunk starts.
+ */
+class PackedRows {
+public:
+    PackedRows(const Column& column, size_t begin) : begin_(begin) {
+        const size_t n = column.size();
+        switch (column.type()) {
+            case ColumnType::Double: {
+                auto view = column.view<double>();
+                if (view.nullCount() == 0) {
+                    data_ = view.data() + begin;
+                    size_ = n - begin;
+                    borrowed_ = true;
+                    return;
+                }
+                for (size_t i = begin; i < n; ++i) {
+                    if (view.isValid(i)) push(view[i], i);
+                }
+                break;
+            }
+            case ColumnType::Int: {
+                auto view = column.view<int32_t>();
+                for (size_t i = begin; i < n; ++i) {
+                    if (view.isValid(i)) push(static_cast<double>(view[i]), i);
+                }
+                break;
+            }
+            case ColumnType::Mixed:
+                for (size_t i = begin; i < n; ++i) {
+                    auto value = column.at(i);
+                    if (!value) continue;
+                    if (std::holds_alternative<int>(*value)) push(static_cast<double>(std::get<int>(*value)), i);
+                    if (std::holds_alternative<double>(*value)) push(std::get<double>(*value), i);
+                }
+                break;
+            default:
+                break;
+        }
+        data_ = owned_.data();
+        size_ = owned_.size();
+    }
+
+    const double* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    /// Row following the first chunks * kChunkSize values (chunks > 0)
+    size_t rowAfter(size_t chunks) const {
+        return borrowed_ ? begin_ + chunks * kChunkSize : chunkEnds_[chunks - 1];
+    }
+
+private:
+    void push(double value, size_t row) {
+        owned_.push_back(value);
+        if (owned_.size() % kChunkSize == 0) chunkEnds_.push_back(row + 1);
+    }
+
+    size_t begin_;
+    bool borrowed_ = false;
+    std::vector<double> owned_;
+    std::vector<size_t> chunkEnds_;
+    const double* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/// Partial sums of the complete chunks of the non-null values of a column
+struct ChunkMoments {
+    size_t rows = 0;              ///< Rows covered by the complete chunks
+    std::vector<double> sums;     ///< Compensated sum of every complete chunk
+    std::vector<double> squares;  ///< Squared deviations of every complete chunk from its own mean
+};
+
+/// Count, mean and population variance of a column
+struct Moments {
+    size_t count = 0;
+    double mean = 0.0;
+    double variance = 0.0;
+};
+
+/// Target size in bytes of one row block of the blocked correlation
+constexpr size_t kBlockBytes = size_t{1} << 20;
+
+/**
+ * @brief Copies rows [begin, end) of a numeric column into a double buffer
+ * 
+ * Reads Int and Double columns through their views, converting on the fly;
+ * null rows read as NaN.
+ */
+void fillRows(const Column& column, size_t begin, size_t end, double* out) {
+    constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+    switch (column.type()) {
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            for (size_t i = begin; i < end; ++i) {
+                *out++ = (view.nullCount() == 0 || view.isValid(i)) ? static_cast<double>(view[i]) : nan;
+            }
+            break;
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            if (view.nullCount() == 0) {
+                std::copy(view.begin() + begin, view.begin() + end, out);
+                break;
+            }
+            // Null rows usually hold NaN, but rows masked by a selection keep their value
+            for (size_t i = begin; i < end; ++i) {
+                *out++ = view.isValid(i) ? view[i] : nan;
+            }
+            break;
+        }
+        default:
+            std::fill(out, out + (end - begin), nan);
+            break;
+    }
+}
+
+/**
+ * @brief Copies rows [begin, end) of a numeric column with nulls masked out
+ * 
+ * Writes value - center to x and 1 to mask for present rows, and 0 to both
+ * for null rows, so masked sums reduce to plain products of x and mask.
+ */
+void fillMaskedRows(const Column& column, size_t begin, size_t end, double center, double* x, double* mask) {
+    switch (column.type()) {
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            for (size_t i = begin; i < end; ++i) {
+                bool valid = view.isValid(i);
+                *x++ = valid ? static_cast<double>(view[i]) - center : 0.0;
+                *mask++ = valid ? 1.0 : 0.0;
+            }
+            break;
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            for (size_t i = begin; i < end; ++i) {
+                bool valid = view.isValid(i);
+                *x++ = valid ? view[i] - center : 0.0;
+                *mask++ = valid ? 1.0 : 0.0;
+            }
+            break;
+        }
+        default:
+            std::fill(x, x + (end - begin), 0.0);
+            std::fill(mask, mask + (end - begin), 0.0);
+            break;
+    }
+}
+
+/**
+ * @brief Pairwise-complete sums of k shifted variables
+ * 
+ * For every pair (i, j), over the rows where both are present: the count
+ * n(i, j), the sums sx(i, j) of x_i and sxx(i, j) of x_i^2, and the sum of
+ * products sxy(i, j). With X the zero-filled values and M the 0/1 masks of a
+ * block these are M^T M, X^T M, (X o X)^T M and X^T X, so a block costs a few
+ * vectorized matrix products instead of one filtered copy per pair.
+ */
+struct PairwiseMoments {
+    explicit PairwiseMoments(size_t k)
+        : n(Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(k))),
+          sx(n), sxx(n), sxy(n) {}
+
+    void pushBlock(const Eigen::Ref<const Eigen::MatrixXd>& x, const Eigen::Ref<const Eigen::MatrixXd>& mask) {
+        n.selfadjointView<Eigen::Upper>().rankUpdate(mask.transpose());
+        sxy.selfadjointView<Eigen::Upper>().rankUpdate(x.transpose());
+        sx.noalias() += x.transpose() * mask;
+        sxx.noalias() += x.cwiseAbs2().transpose() * mask;
+    }
+
+    void merge(const PairwiseMoments& other) {
+        n += other.n;
+        sx += other.sx;
+        sxx += other.sxx;
+        sxy += other.sxy;
+    }
+
+    /// Correlation of every pair over its complete rows (NaN below two rows)
+    Eigen::MatrixXd correlation(bool upperTriangleOnly) const {
+        const Eigen::Index k = n.rows();
+        Eigen::MatrixXd r = Eigen::MatrixXd::Zero(k, k);
+        for (Eigen::Index j = 0; j < k; ++j) {
+            for (Eigen::Index i = 0; i <= j; ++i) {
+                const double count = n(i, j);
+                if (count < 2.0) {
+                    r(i, j) = std::numeric_limits<double>::quiet_NaN();
+                    continue;
+                }
+                const double cxy = sxy(i, j) - sx(i, j) * sx(j, i) / count;
+                const double cxx = sxx(i, j) - sx(i, j) * sx(i, j) / count;
+                const double cyy = sxx(j, i) - sx(j, i) * sx(j, i) / count;
+                r(i, j) = cxy / std::sqrt(cxx * cyy);
+            }
+        }
+        if (!upperTriangleOnly) {
+            r.triangularView<Eigen::StrictlyLower>() = r.transpose();
+        }
+        return r;
+    }
+
+    Eigen::MatrixXd n, sx, sxx, sxy;
+};
+
+/**
+ * @brief Folds the rows [first, rows) into an accumulator, stripe by stripe
+ * 
+ * Each stripe of rows is handled by one task calling fold(acc, begin, end)
+ * on its own empty accumulator (a copy of empty). Stripes run in waves of
+ * `threads` tasks, so at most `threads` partial accumulators are alive, and
+ * are merged in stripe order: the result does not depend on the thread count.
+ * 
+ * @param first Start of the first stripe, a multiple of stripeRows
+ */
+template <typename Acc, typename Fold>
+void foldStripes(Acc& total, const Acc& empty, size_t first, size_t rows, size_t stripeRows,
+                 unsigned threads, Fold&& fold) {
+    const size_t stripes = rows > first ? (rows - first + stripeRows - 1) / stripeRows : 0;
+    for (size_t wave = 0; wave < stripes; wave += threads) {
+        const size_t tasks = std::min<size_t>(threads, stripes - wave);
+        std::vector<Acc> partial(tasks, empty);
+        parallelFor(tasks, threads, [&](size_t t) {
+            const size_t begin = first + (wave + t) * stripeRows;
+            fold(partial[t], begin, std::min(rows, begin + stripeRows));
+        });
+        for (const auto& p : partial) {
+            total.merge(p);
+        }
+    }
+}
+
+/**
+ * @brief Shared driver of the rank correlation matrices
+ * 
+ * Keeps the rows where every column is present (listwise deletion), ranks each
+ * column once in parallel, then evaluates pair(x, y) for every pair of ranked
+ * columns in parallel. Every entry is computed independently, so the result
+ * does not depend on the thread count.
+ */
+template <typename Pair>
+Eigen::MatrixXd rankCorrelationMatrix(const Dataset& dataset, const std::vector<std::string>& columnNames,
+                                      bool upperTriangleOnly, unsigned threads, Pair&& pair) {
+    if (columnNames.empty()) {
+        throw std::invalid_argument("No columns specified for correlation analysis");
+    }
+    const size_t k = columnNames.size();
+    for (const auto& name : columnNames) {
+        if (!dataset.column(name).isNumeric()) {
+            throw std::invalid_argument("Column '" + name + "' is not numeric");
+        }
+    }
+
+    // Row-aligned values, NaN where null
+    std::vector<std::vector<double>> values(k);
+    parallelFor(k, threads, [&](size_t j) { values[j] = dataset.column(columnNames[j]).asDoubles(); });
+
+    const size_t rows = dataset.size();
+    std::vector<char> complete(rows, 1);
+    size_t kept = rows;
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            if (std::isnan(values[j][i])) {
+                complete[i] = 0;
+                --kept;
+                break;
+            }
+        }
+    }
+    if (kept < 2) {
+        throw std::runtime_error("At least two complete rows are needed for a rank correlation");
+    }
+
+    std::vector<RankedColumn> ranked(k);
+    parallelFor(k, threads, [&](size_t j) {
+        if (kept < rows) {
+            size_t out = 0;
+            for (size_t i = 0; i < rows; ++i) {
+                if (complete[i]) values[j][out++] = values[j][i];
+            }
+            values[j].resize(out);
+        }
+        ranked[j] = RankedColumn(values[j]);
+        std::vector<double>().swap(values[j]);
+    });
+
+    std::vector<std::pair<size_t, size_t>> pairs;
+    pairs.reserve(k * (k + 1) / 2);
+    for (size_t j = 0; j < k; ++j) {
+        for (size_t i = 0; i <= j; ++i) {
+            pairs.emplace_back(i, j);
+        }
+    }
+    Eigen::MatrixXd r = Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(k), static_cast<Eigen::Index>(k));
+    parallelFor(pairs.size(), threads, [&](size_t p) {
+        auto [i, j] = pairs[p];
+        r(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j)) = pair(ranked[i], ranked[j]);
+    });
+    if (!upperTriangleOnly) {
+        r.triangularView<Eigen::StrictlyLower>() = r.transpose();
+    }
+    return r;
+}
+
+/// Largest value range of an Int column counted into a dense array
+constexpr int64_t kDenseRange = int64_t{1} << 20;
+
+/**
+ * @brief Splits [0, n) into one contiguous range per worker and runs task(begin, end, part)
+ * @return Number of parts
+ */
+template <typename Task>
+size_t forEachPart(size_t n, unsigned threads, Task&& task) {
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(threads, chunkCount(n)));
+    parallelFor(parts, threads, [&](size_t p) {
+        task(n * p / parts, n * (p + 1) / parts, p);
+    });
+    return parts;
+}
+
+/**
+ * @brief Counts small integer keys into one dense array per worker and sums the arrays
+ * @param n Number of rows
+ * @param range Number of distinct keys (keys are 0 .. range - 1)
+ * @param keyOf keyOf(row) returns the key of a row, or -1 to skip it
+ */
+template <typename KeyOf>
+std::vector<size_t> denseCounts(size_t n, size_t range, unsigned threads, KeyOf&& keyOf) {
+    std::vector<std::vector<size_t>> partial(std::max<size_t>(1, std::min<size_t>(threads, chunkCount(n))));
+    forEachPart(n, threads, [&](size_t begin, size_t end, size_t p) {
+        std::vector<size_t> counts(range, 0);
+        for (size_t i = begin; i < end; ++i) {
+            int64_t key = keyOf(i);
+            if (key >= 0) ++counts[static_cast<size_t>(key)];
+        }
+        partial[p] = std::move(counts);
+    });
+    for (size_t p = 1; p < partial.size(); ++p) {
+        for (size_t key = 0; key < range; ++key) partial[0][key] += partial[p][key];
+    }
+    return std::move(partial[0]);
+}
+
+/**
+ * @brief Counts the non-null values of a column, following the conversions of getColumn<T>
+ * 
+ * - String columns count their dictionary codes into dense arrays: no hashing
+ *   and no string is touched until the final table of distinct values.
+ * - Int columns with a small value range count into dense arrays as well.
+ * - Other numeric columns count into one flat hash table per worker, merged
+ *   at the end.
+ * - Mixed columns go through Column::values<T>.
+ * 
+ * @tparam T double or std::string
+ * @throws std::runtime_error if the column has no value of type T
+ */
+template <typename T>
+FrequencyTable<T> countValues(const Column& column, const std::string& name, unsigned threads) {
+    const size_t n = column.size();
+    FrequencyTable<T> table;
+    if constexpr (std::is_same_v<T, std::string>) {
+        if (column.type() == ColumnType::String) {
+            auto codes = column.view<uint32_t>();
+            const auto& dictionary = column.dictionary();
+            auto counts = denseCounts(n, dictionary.size(), threads, [&codes](size_t i) -> int64_t {
+                return codes.isValid(i) ? static_cast<int64_t>(codes[i]) : -1;
+            });
+            table = FrequencyTable<T>(dictionary.size());
+            for (size_t code = 0; code < counts.size(); ++code) {
+                table.add(std::string(dictionary[code]), counts[code]);
+            }
+        } else if (column.type() == ColumnType::Mixed) {
+            for (const auto& v : column.values<T>()) table.add(v);
+        }
+    } else if (column.type() == ColumnType::Int) {
+        auto view = column.view<int32_t>();
+        int64_t lo = std::numeric_limits<int32_t>::max(), hi = std::numeric_limits<int32_t>::min();
+        for (size_t i = 0; i < n; ++i) {
+            if (view.isValid(i)) {
+                lo = std::min<int64_t>(lo, view[i]);
+                hi = std::max<int64_t>(hi, view[i]);
+            }
+        }
+        if (lo <= hi && hi - lo < kDenseRange && static_cast<size_t>(hi - lo) <= 4 * n) {
+            auto counts = denseCounts(n, static_cast<size_t>(hi - lo + 1), threads, [&view, lo](size_t i) -> int64_t {
+                return view.isValid(i) ? view[i] - lo : -1;
+            });
+            for (size_t key = 0; key < counts.size(); ++key) {
+                table.add(static_cast<T>(lo + static_cast<int64_t>(key)), counts[key]);
+            }
+        } else if (lo <= hi) {
+            std::vector<FrequencyTable<int32_t>> partial(std::min<size_t>(threads, chunkCount(n)));
+            forEachPart(n, threads, [&](size_t begin, size_t end, size_t p) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (view.isValid(i)) partial[p].add(view[i]);
+                }
+            });
+            for (const auto& part : partial) {
+                part.forEach([&table](int32_t key, size_t count) { table.add(static_cast<T>(key), count); });
+            }
+        }
+    } else if (column.type() == ColumnType::Double) {
+        auto view = column.view<double>();
+        std::vector<FrequencyTable<double>> partial(std::min<size_t>(threads, chunkCount(n)));
+        forEachPart(n, threads, [&](size_t begin, size_t end, size_t p) {
+            for (size_t i = begin; i < end; ++i) {
+                if (view.isValid(i)) partial[p].add(view[i]);
+            }
+        });
+        for (const auto& part : partial) {
+            table.merge(part);
+        }
+    } else if (column.type() == ColumnType::Mixed) {
+        for (const auto& v : column.values<T>()) table.add(v);
+    }
+
+    if (table.total() == 0) {
+        throw std::runtime_error("No valid data of requested type found in column '" + name + "'");
+    }
+    return table;
+}
+
+/// Rows converted per block when an Int column is binned
+constexpr size_t kBinBlock = size_t{1} << 14;
+
+/// Rows sampled to place the inner edges of Binning::Quantile
+constexpr size_t kEdgeSample = size_t{1} << 20;
+
+/**
+ * @brief Widens the range [value, value] of a constant column into one that histograms accept
+ *
+ * The half-width is 0.5, or the spacing of doubles near value once 0.5 is too
+ * small to change it (|value| beyond 2^52); the bounds stay finite.
+ */
+std::pair<double, double> widenedRange(double value) {
+    const double half = std::max(0.5, std::abs(value) * std::numeric_limits<double>::epsilon());
+    return {std::max(value - half, std::numeric_limits<double>::lowest()),
+            std::min(value + half, std::numeric_limits<double>::max())};
+}
+
+/**
+ * @brief Splits [0, n) into one range per worker, cut on multiples of 64 so
+ *        that every range starts on a validity word, and runs task(begin, end, part)
+ * @return Number of parts
+ */
+template <typename Task>
+size_t forEachAlignedPart(size_t n, unsigned threads, Task&& task) {
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(threads, chunkCount(n)));
+    parallelFor(parts, threads, [&](size_t p) {
+        size_t begin = (n * p / parts) & ~size_t{63};
+        size_t end = p + 1 == parts ? n : (n * (p + 1) / parts) & ~size_t{63};
+        task(begin, end, p);
+    });
+    return parts;
+}
+
+/**
+ * @brief Calls f(value) for every non-null, non-NaN value of the rows [begin, end) of a numeric column
+ * @throws std::runtime_error if the column holds strings
+ */
+template <typename F>
+void forEachNumericIn(const Column& column, size_t begin, size_t end, F&& f) {
+    switch (column.type()) {
+        case ColumnType::Int: {
+            auto view = column.view<int32_t>();
+            for (size_t i = begin; i < end; ++i) {
+                if (view.isValid(i)) f(static_cast<double>(view[i]));
+            }
+            break;
+        }
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            for (size_t i = begin; i < end; ++i) {
+                if (view.isValid(i) && !std::isnan(view[i])) f(view[i]);
+            }
+            break;
+        }
+        case ColumnType::Empty:
+            break;
+        default:
+            throw std::runtime_error("Column is not numeric");
+    }
+}
+
+/**
+ * @brief Adds the non-null values of a numeric column to a histogram, one partial histogram per worker
+ * @throws std::runtime_error if the column holds strings
+ */
+Histogram fillHistogram(const Column& column, Histogram bins, unsigned threads) {
+    if (column.type() != ColumnType::Int && column.type() != ColumnType::Double) {
+        if (column.type() != ColumnType::Empty) {
+            throw std::runtime_error("Column is not numeric");
+        }
+        return bins;
+    }
+    Histogram empty = bins;
+    empty.clear();
+    std::vector<Histogram> partial(std::max<size_t>(1, std::min<size_t>(threads, chunkCount(column.size()))), empty);
+    forEachAlignedPart(column.size(), threads, [&](size_t begin, size_t end, size_t p) {
+        if (column.type() == ColumnType::Double) {
+            auto view = column.view<double>();
+            partial[p].add(view.data() + begin, end - begin, view.nullCount() > 0 ? view.validity() + begin / 64 : nullptr);
+            return;
+        }
+        auto view = column.view<int32_t>();
+        std::vector<double> block(std::min(kBinBlock, end - begin));
+        for (size_t i = begin; i < end; i += kBinBlock) {
+            const size_t m = std::min(kBinBlock, end - i);
+            std::copy(view.data() + i, view.data() + i + m, block.begin());
+            partial[p].add(block.data(), m, view.nullCount() > 0 ? view.validity() + i / 64 : nullptr);
+        }
+    });
+    for (const auto& part : partial) {
+        bins.merge(part);
+    }
+    return bins;
+}
+
+/**
+ * @brief Adds the non-null values of a column to a distinct-count sketch
+ *
+ * Numeric columns fill one sketch per worker, merged at the end. String
+ * columns mark the dictionary codes used by a row and hash each of those
+ * strings once. Mixed columns go value by value.
+ */
+CardinalitySketch sketchColumn(const Column& column, uint8_t precision, unsigned threads) {
+    CardinalitySketch sketch(precision);
+    const size_t n = column.size();
+    switch (column.type()) {
+        case ColumnType::Int:
+        case ColumnType::Double: {
+            std::vector<CardinalitySketch> partial(std::max<size_t>(1, std::min<size_t>(threads, chunkCount(n))), sketch);
+            forEachAlignedPart(n, threads, [&](size_t begin, size_t end, size_t p) {
+                if (column.type() == ColumnType::Int) {
+                    auto view = column.view<int32_t>();
+                    partial[p].add(view.data() + begin, end - begin, view.nullCount() > 0 ? view.validity() + begin / 64 : nullptr);
+                } else {
+                    auto view = column.view<double>();
+                    partial[p].add(view.data() + begin, end - begin, view.nullCount() > 0 ? view.validity() + begin / 64 : nullptr);
+                }
+            });
+            for (const auto& part : partial) {
+                sketch.merge(part);
+            }
+            break;
+        }
+        case ColumnType::String: {
+            auto codes = column.view<uint32_t>();
+            const auto& dictionary = column.dictionary();
+            auto counts = denseCounts(n, dictionary.size(), threads, [&codes](size_t i) -> int64_t {
+                return codes.isValid(i) ? static_cast<int64_t>(codes[i]) : -1;
+            });
+            for (size_t code = 0; code < counts.size(); ++code) {
+                if (counts[code] > 0) sketch.add(dictionary[code]);
+            }
+            break;
+        }
+        case ColumnType::Mixed:
+            for (size_t i = 0; i < n; ++i) {
+                if (auto value = column.at(i)) {
+                    std::visit([&sketch](const auto& v) {
+                        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) {
+                            sketch.add(std::string_view(v));
+                        } else {
+                            sketch.add(static_cast<double>(v));
+                        }
+                    }, *value);
+                }
+            }
+            break;
+        case ColumnType::Empty:
+            break;
+    }
+    return sketch;
+}
+
+} // namespace
+
+/**
+ * @brief Partial results kept between queries while the dataset only grows
+ * 
+ * Everything is keyed by the revision of the dataset and dropped when it
+ * changes. Complete chunks (stripes for correlations) never change while rows
+ * are only appended, so a query resumes after the last complete one and
+ * recomputes the incomplete tail only.
+ */
+struct StatisticalAnalyzer::Cache {
+    /// Sums of the complete row stripes of one correlation or regression query
+    struct Correlation {
+        size_t rows = 0;              ///< Rows covered by the complete stripes
+        CoMoments moments;            ///< Without nulls, with MissingPolicy::Propagate, or complete rows only
+        PairwiseMoments pairwise{0};  ///< With nulls and MissingPolicy::PairwiseComplete
+        std::vector<double> centers;  ///< Shifts of the pairwise sums
+    };
+
+    /// At most this many correlation queries are kept; older ones are dropped together
+    static constexpr size_t kMaxCorrelations = 32;
+
+    /// Drops the partial results of another revision of the dataset
+    void sync(const Dataset& dataset) {
+        if (dataset.revision() != revision) {
+            columns.clear();
+            correlations.clear();
+            revision = dataset.revision();
+        }
+    }
+
+    /**
+     * @brief Moments of the non-null numeric values of a column
+     * 
+     * Values are summed in chunks of kChunkSize values combined in chunk order,
+     * so the result depends neither on the thread count nor on when the rows
+     * were appended. The variance combines the squared deviations of every
+     * chunk from its own mean with the spread of the chunk means.
+     */
+    Moments columnMoments(const Dataset& dataset, const std::string& name, unsigned threads) {
+        const Column& column = dataset.column(name);
+        std::lock_guard<std::mutex> lock(mutex);
+        sync(dataset);
+        ChunkMoments& chunks = columns[name];
+        PackedRows values(column, chunks.rows);
+
+        const size_t complete = values.size() / kChunkSize;
+        const size_t first = chunks.sums.size();
+        chunks.sums.resize(first + complete);
+        chunks.squares.resize(first + complete);
+        parallelFor(complete, threads, [&](size_t c) {
+            const double* x = values.data() + c * kChunkSize;
+            const double sum = Kernels::compensatedSum(x, kChunkSize);
+            chunks.sums[first + c] = sum;
+            chunks.squares[first + c] = Kernels::sumSquaredDeviations(x, kChunkSize, sum / kChunkSize);
+        });
+        if (complete > 0) {
+            chunks.rows = values.rowAfter(complete);
+        }
+
+        // The incomplete last chunk is recomputed by every query
+        std::vector<double> sums = chunks.sums;
+        std::vector<double> counts(sums.size(), static_cast<double>(kChunkSize));
+        std::vector<double> squares = chunks.squares;
+        const size_t tail = values.size() - complete * kChunkSize;
+        if (tail > 0) {
+            const double* x = values.data() + complete * kChunkSize;
+            sums.push_back(Kernels::compensatedSum(x, tail));
+            counts.push_back(static_cast<double>(tail));
+            squares.push_back(Kernels::sumSquaredDeviations(x, tail, sums.back() / tail));
+        }
+
+        Moments out;
+        out.count = chunks.sums.size() * kChunkSize + tail;
+        if (out.count == 0) {
+            return out;
+        }
+        out.mean = Kernels::compensatedSum(sums.data(), sums.size()) / out.count;
+        for (size_t c = 0; c < squares.size(); ++c) {
+            const double shift = sums[c] / counts[c] - out.mean;
+            squares[c] += counts[c] * shift * shift;
+        }
+        out.variance = Kernels::compensatedSum(squares.data(), squares.size()) / out.count;
+        return out;
+    }
+
+    std::mutex mutex;
+    uint64_t revision = 0;
+    std::unordered_map<std::string, ChunkMoments> columns;
+    std::unordered_map<std::string, Correlation> correlations;
+};
+
 /**
  * @brief Constructor for StatisticalAnalyzer
  * @param ds Shared pointer to a Dataset object
+ * @param threads Number of threads used by the analysis, 0 for one per hardware thread
  * @throws std::invalid_argument if dataset is empty
  */
-StatisticalAnalyzer::StatisticalAnalyzer(std::shared_ptr<Dataset> ds) : dataset(ds) {
+StatisticalAnalyzer::StatisticalAnalyzer(std::shared_ptr<Dataset> ds, unsigned threads)
+    : dataset(ds), cache(std::make_shared<Cache>()), threadCount(resolveThreads(threads)) {
     if (!dataset) {
         throw std::invalid_argument("Dataset is empty");
     }
@@ -25,6 +787,13 @@ StatisticalAnalyzer::StatisticalAnalyzer(std::shared_ptr<Dataset> ds) : dataset(
  */
 template<typename T>    
 double StatisticalAnalyzer::mean(const std::string& ColumnName) const{
+    if constexpr (std::is_same_v<T, double>) {
+        Moments moments = cache->columnMoments(*dataset, ColumnName, threadCount);
+        if (moments.count == 0) {
+            throw std::runtime_error("No valid data of requested type found in column '" + ColumnName + "'");
+        }
+        return moments.mean;
+    }
     auto data = dataset->getColumn<T>(ColumnName);
     if (data.empty()) {
         throw std::invalid_argument("Cannot compute mean of a column that does not exist");
@@ -45,11 +814,91 @@ double StatisticalAnalyzer::median(const std::string& ColumnName) const {
     if (data.empty()) {
         throw std::invalid_argument("Cannot compute median of a column that does not exist");
     }
-    std::sort(data.begin(), data.end());
-    if (data.size() % 2 == 0) {
-        return (data[data.size() / 2 - 1] + data[data.size() / 2]) / 2.0;
-    }
-    return data[data.size() / 2];
+    return quantileInPlace(data, 0.5);
+}
+
+/**
+ * @brief Calculates several quantiles of a column with one selection pass
+ * @tparam T Data type of the column
+ * @param ColumnName Name of the column to analyze
+ * @param probabilities Probabilities in [0, 1]
+ * @return Vector of quantiles in the order of probabilities
+ */
+template<typename T>
+std::vector<double> StatisticalAnalyzer::quantiles(const std::string& ColumnName,
+                                                   const std::vector<double>& probabilities) const {
+    auto data = dataset->getColumn<T>(ColumnName);
+    return quantilesInPlace(data, probabilities);
+}
+
+/**
+ * @brief Calculates one quantile of a column
+ * @tparam T Data type of the column
+ * @param ColumnName Name of the column to analyze
+ * @param probability Probability in [0, 1]
+ * @return Double value representing the quantile
+ */
+template<typename T>
+double StatisticalAnalyzer::quantile(const std::string& ColumnName, double probability) const {
+    auto data = dataset->getColumn<T>(ColumnName);
+    return quantileInPlace(data, probability);
+}
+
+/**
+ * @brief Calculates one percentile of a column
+ * @tparam T Data type of the column
+ * @param ColumnName Name of the column to analyze
+ * @param percent Percentile in [0, 100]
+ * @return Double value representing the percentile
+ */
+template<typename T>
+double StatisticalAnalyzer::percentile(const std::string& ColumnName, double percent) const {
+    return quantile<T>(ColumnName, percent / 100.0);
+}
+
+/**
+ * @brief Calculates the interquartile range of a column
+ * @tparam T Data type of the column
+ * @param ColumnName Name of the column to analyze
+ * @return Double value representing Q3 - Q1
+ */
+template<typename T>
+double StatisticalAnalyzer::interquartileRange(const std::string& ColumnName) const {
+    auto q = quantiles<T>(ColumnName, {0.25, 0.75});
+    return q[1] - q[0];
+}
+
+/**
+ * @brief Builds a quantile sketch over a numeric column
+ * @param ColumnName Name of the column to analyze
+ * @param k Accuracy parameter of the sketch
+ * @return QuantileSketch over the non-null values of the column
+ */
+QuantileSketch StatisticalAnalyzer::quantileSketch(const std::string& ColumnName, uint16_t k) const {
+    QuantileSketch sketch(k);
+    forEachNumeric(dataset->column(ColumnName), [&sketch](double v) { sketch.update(v); });
+    return sketch;
+}
+
+/**
+ * @brief Calculates an approximate quantile of a column
+ * @param ColumnName Name of the column to analyze
+ * @param probability Probability in [0, 1]
+ * @param k Accuracy parameter of the sketch
+ * @return Double value representing the approximate quantile
+ */
+double StatisticalAnalyzer::approxQuantile(const std::string& ColumnName, double probability, uint16_t k) const {
+    return quantileSketch(ColumnName, k).quantile(probability);
+}
+
+/**
+ * @brief Calculates an approximate median of a column
+ * @param ColumnName Name of the column to analyze
+ * @param k Accuracy parameter of the sketch
+ * @return Double value representing the approximate median
+ */
+double StatisticalAnalyzer::approxMedian(const std::string& ColumnName, uint16_t k) const {
+    return approxQuantile(ColumnName, 0.5, k);
 }
 
 /**
@@ -61,11 +910,18 @@ double StatisticalAnalyzer::median(const std::string& ColumnName) const {
  */
 template<typename T>
 double StatisticalAnalyzer::variance(const std::string& ColumnName) const {
+    if constexpr (std::is_same_v<T, double>) {
+        Moments moments = cache->columnMoments(*dataset, ColumnName, threadCount);
+        if (moments.count == 0) {
+            throw std::runtime_error("No valid data of requested type found in column '" + ColumnName + "'");
+        }
+        return moments.variance;
+    }
     auto data = dataset->getColumn<T>(ColumnName);
     if (data.empty()) {
         throw std::invalid_argument("Cannot compute variance of a column that does not exist");
     }
-    double m = mean<T>(ColumnName);
+    double m = std::accumulate(data.begin(), data.end(), 0.0) / data.size();
     double accum = 0.0;
     for (const auto& val : data) {
         accum += (val - m) * (val - m);
@@ -84,24 +940,327 @@ double StatisticalAnalyzer::standardDeviation(const std::string& ColumnName) con
     return std::sqrt(variance<T>(ColumnName));
 }
 
+/**
+ * @brief Summarizes several columns from a single extraction each
+ * @param columnNames Vector of column names to analyze
+ * @param probabilities Probabilities of the quantiles to compute
+ * @return Vector of ColumnSummary, one per column
+ * @throws std::invalid_argument if a probability is outside [0, 1]
+ */
+std::vector<ColumnSummary> StatisticalAnalyzer::describe(const std::vector<std::string>& columnNames,
+                                                         const std::vector<double>& probabilities) const {
+    for (double p : probabilities) {
+        if (!(p >= 0.0 && p <= 1.0)) {
+            throw std::invalid_argument("Quantile probabilities must be in [0, 1]");
+        }
+    }
+
+    const size_t columns = columnNames.size();
+
+    // Extract (or borrow) every column concurrently
+    std::vector<std::unique_ptr<NumericBuffer>> buffers(columns);
+    parallelFor(columns, threadCount, [&](size_t c) {
+        buffers[c] = std::make_unique<NumericBuffer>(*dataset, columnNames[c]);
+    });
+
+    // One job per fixed-size chunk of every column, so short and long columns
+    // share the threads evenly
+    struct Job { size_t column, begin, end; };
+    std::vector<Job> jobs;
+    std::vector<size_t> firstJob(columns + 1, 0);
+    for (size_t c = 0; c < columns; ++c) {
+        firstJob[c] = jobs.size();
+        const size_t n = buffers[c]->size();
+        for (size_t begin = 0; begin < n; begin += kChunkSize) {
+            jobs.push_back({c, begin, std::min(n, begin + kChunkSize)});
+        }
+    }
+    firstJob[columns] = jobs.size();
+
+    // Pass 1: per-chunk sums and extremes
+    std::vector<double> partialSum(jobs.size()), partialMin(jobs.size()), partialMax(jobs.size());
+    parallelFor(jobs.size(), threadCount, [&](size_t j) {
+        const double* x = buffers[jobs[j].column]->data() + jobs[j].begin;
+        const size_t n = jobs[j].end - jobs[j].begin;
+        partialSum[j] = Kernels::compensatedSum(x, n);
+        Kernels::minMax(x, n, partialMin[j], partialMax[j]);
+    });
+
+    std::vector<ColumnSummary> summaries(columns);
+    for (size_t c = 0; c < columns; ++c) {
+        const size_t first = firstJob[c], last = firstJob[c + 1];
+        ColumnSummary& summary = summaries[c];
+        summary.column = columnNames[c];
+        summary.count = buffers[c]->size();
+        summary.mean = Kernels::compensatedSum(partialSum.data() + first, last - first) / summary.count;
+        double unused;
+        Kernels::minMax(partialMin.data() + first, last - first, summary.min, unused);
+        Kernels::minMax(partialMax.data() + first, last - first, unused, summary.max);
+        summary.probabilities = probabilities;
+    }
+
+    // Pass 2: per-chunk squared deviations from the column mean
+    std::vector<double> partialSsd(jobs.size());
+    parallelFor(jobs.size(), threadCount, [&](size_t j) {
+        const double* x = buffers[jobs[j].column]->data() + jobs[j].begin;
+        partialSsd[j] = Kernels::sumSquaredDeviations(x, jobs[j].end - jobs[j].begin,
+                                                      summaries[jobs[j].column].mean);
+    });
+
+    // Quantiles by selection, which reorders the values: copy only when asked for
+    parallelFor(columns, threadCount, [&](size_t c) {
+        const size_t first = firstJob[c], last = firstJob[c + 1];
+        ColumnSummary& summary = summaries[c];
+        summary.variance = Kernels::compensatedSum(partialSsd.data() + first, last - first) / summary.count;
+        summary.standardDeviation = std::sqrt(summary.variance);
+        if (!probabilities.empty()) {
+            std::vector<double> values = buffers[c]->release();
+            summary.quantiles = quantilesInPlace(values, probabilities);
+        }
+    });
+    return summaries;
+}
+
 /**
  * @brief Counts the frequency of each unique value in a column
  * @tparam T Data type of the column
  * @param ColumnName Name of the column to analyze
  * @return Unordered map with values as keys and their frequencies as values
- * @throws std::invalid_argument if column doesn't exist
+ * @throws std::runtime_error if column doesn't exist or has no value of type T
  */
 template<typename T>
 std::unordered_map<T, size_t> StatisticalAnalyzer::frequencyCount(const std::string& ColumnName) const {
-    auto data = dataset->getColumn<T>(ColumnName);
-    if (data.empty()) {
-        throw std::invalid_argument("Cannot compute frequency count of a column that does not exist");
+    return frequencyTable<T>(ColumnName).toMap();
+}
+
+/**
+ * @brief Counts the occurrences of every distinct value of a column
+ * @tparam T double or std::string
+ * @param ColumnName Name of the column to analyze
+ * @return FrequencyTable with one entry per distinct non-null value
+ * @throws std::runtime_error if the column doesn't exist or has no value of type T
+ */
+template<typename T>
+FrequencyTable<T> StatisticalAnalyzer::frequencyTable(const std::string& ColumnName) const {
+    return countValues<T>(dataset->column(ColumnName), ColumnName, threadCount);
+}
+
+/**
+ * @brief Returns the k most frequent values of a column
+ * @tparam T double or std::string
+ * @param ColumnName Name of the column to analyze
+ * @param k Number of values to return
+ * @return Up to k (value, count) pairs by decreasing count (ties by value)
+ */
+template<typename T>
+std::vector<std::pair<T, size_t>> StatisticalAnalyzer::mostFrequent(const std::string& ColumnName, size_t k) const {
+    return frequencyTable<T>(ColumnName).topK(k);
+}
+
+/**
+ * @brief Builds a distinct-count sketch over a column
+ * @param ColumnName Name of the column to summarize
+ * @param precision log2 of the number of registers of the sketch
+ * @return CardinalitySketch fed with every non-null value of the column
+ */
+CardinalitySketch StatisticalAnalyzer::cardinalitySketch(const std::string& ColumnName, uint8_t precision) const {
+    return sketchColumn(dataset->column(ColumnName), precision, threadCount);
+}
+
+/**
+ * @brief Estimates the number of distinct non-null values of a column
+ * @param ColumnName Name of the column to analyze
+ * @param precision log2 of the number of registers of the sketch
+ * @return Estimated distinct count (exact while it stays small)
+ */
+uint64_t StatisticalAnalyzer::approxDistinctCount(const std::string& ColumnName, uint8_t precision) const {
+    return cardinalitySketch(ColumnName, precision).estimate();
+}
+
+/**
+ * @brief Groups the rows of the dataset by key columns
+ * @param keys Key columns
+ * @return GroupBy over the analyzed dataset
+ */
+GroupBy StatisticalAnalyzer::groupBy(const std::vector<std::string>& keys) const {
+    return GroupBy(dataset, keys, threadCount, selection.get());
+}
+
+/**
+ * @brief Builds a histogram of a column with bins fitted to its values
+ * @param ColumnName Name of the column to analyze
+ * @param bins Number of bins
+ * @param binning Layout of the bins
+ * @return Histogram of the non-null values of the column
+ */
+Histogram StatisticalAnalyzer::histogram(const std::string& ColumnName, size_t bins, Binning binning) const {
+    if (bins == 0) {
+        throw std::invalid_argument("Number of bins must be positive");
     }
-    std::unordered_map<T, size_t> freqMap;
-    for (const auto& val : data) {
-        freqMap[val]++;
+    const Column& column = dataset->column(ColumnName);
+    const size_t n = column.size();
+
+    // Smallest (positive, for Log) and largest finite value, one pair per worker;
+    // infinities end up in the underflow and overflow
+    const bool positive = binning == Binning::Log;
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(threadCount, chunkCount(n)));
+    std::vector<std::pair<double, double>> ranges(parts, {std::numeric_limits<double>::infinity(),
+                                                          -std::numeric_limits<double>::infinity()});
+    forEachPart(n, threadCount, [&](size_t begin, size_t end, size_t p) {
+        auto& [lo, hi] = ranges[p];
+        forEachNumericIn(column, begin, end, [&lo = lo, &hi = hi, positive](double v) {
+            if (!std::isfinite(v) || (positive && v <= 0.0)) return;
+            lo = std::min(lo, v);
+            hi = std::max(hi, v);
+        });
+    });
+    double lo = std::numeric_limits<double>::infinity(), hi = -lo;
+    for (const auto& range : ranges) {
+        lo = std::min(lo, range.first);
+        hi = std::max(hi, range.second);
+    }
+    if (lo > hi) {
+        if (positive && n > 0 && column.isNumeric()) {
+            throw std::invalid_argument("Column '" + ColumnName + "' has no positive value for a log-scale histogram");
+        }
+        throw std::runtime_error("No valid data of requested type found in column '" + ColumnName + "'");
+    }
+
+    switch (binning) {
+        case Binning::Log:
+            if (lo == hi) {
+                lo = std::max(lo * 0.5, std::numeric_limits<double>::denorm_min());
+                hi = std::min(hi * 2.0, std::numeric_limits<double>::max());
+            }
+            return fillHistogram(column, Histogram::logarithmic(lo, hi, bins), threadCount);
+        case Binning::Quantile: {
+            // Inner edges from evenly spaced rows: with 2^20 of them the rank
+            // error of an edge is about 0.05%, at the cost of a few cache misses
+            const size_t stride = std::max<size_t>(1, n / kEdgeSample);
+            std::vector<double> sample;
+            for (size_t i = 0; i < n; i += stride) {
+                forEachNumericIn(column, i, i + 1, [&sample](double v) {
+                    if (std::isfinite(v)) sample.push_back(v);
+                });
+            }
+            std::sort(sample.begin(), sample.end());
+            std::vector<double> edges = {lo};
+            for (size_t b = 1; b < bins && !sample.empty(); ++b) {
+                edges.push_back(sample[b * (sample.size() - 1) / bins]);
+            }
+            edges.push_back(hi);
+            edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+            if (edges.size() == 1) {
+                auto [left, right] = widenedRange(lo);
+                edges = {left, right};
+            }
+            return fillHistogram(column, Histogram::fromEdges(std::move(edges)), threadCount);
+        }
+        case Binning::Linear:
+            break;
+    }
+    if (lo == hi) {
+        std::tie(lo, hi) = widenedRange(lo);
+    }
+    return fillHistogram(column, Histogram::linear(lo, hi, bins), threadCount);
+}
+
+/**
+ * @brief Adds the values of a column to a histogram with given bins
+ * @param ColumnName Name of the column to analyze
+ * @param bins Histogram whose bins (and counts) are used
+ * @return bins with the non-null values of the column added
+ */
+Histogram StatisticalAnalyzer::histogram(const std::string& ColumnName, Histogram bins) const {
+    return fillHistogram(dataset->column(ColumnName), std::move(bins), threadCount);
+}
+
+StatisticalAnalyzer StatisticalAnalyzer::where(const Selection& rows) const {
+    StatisticalAnalyzer out(std::make_shared<Dataset>(Dataset::where(dataset, rows)), threadCount);
+    out.selection = std::make_shared<const Selection>(selection ? *selection & rows : rows);
+    return out;
+}
+
+StatisticalAnalyzer StatisticalAnalyzer::where(const Filter& filter) const {
+    return where(filter.evaluate(*dataset, threadCount));
+}
+
+/**
+ * @brief Co-moments of numeric columns, folded stripe by stripe and cached
+ * 
+ * Rows are streamed in blocks of about kBlockBytes, converted straight from
+ * the column buffers; each stripe of kChunkSize rows is accumulated by one
+ * task. Block and stripe sizes depend only on the number of columns.
+ * Complete stripes are folded into the cache once; the last, incomplete
+ * stripe is folded into a copy by every query.
+ * 
+ * @param columnNames Numeric columns
+ * @param listwise If true, rows with a null in any column are skipped;
+ *        otherwise nulls enter as NaN
+ * @throws std::invalid_argument if a column is not numeric
+ */
+CoMoments StatisticalAnalyzer::coMoments(const std::vector<std::string>& columnNames, bool listwise) const {
+    const size_t k = columnNames.size();
+    const size_t rows = dataset->size();
+    std::vector<const Column*> sources(k);
+    bool hasNulls = false;
+    for (size_t j = 0; j < k; ++j) {
+        sources[j] = &dataset->column(columnNames[j]);
+        if (!sources[j]->isNumeric()) {
+            throw std::invalid_argument("Column '" + columnNames[j] + "' is not numeric");
+        }
+        hasNulls = hasNulls || sources[j]->nullCount() > 0;
+    }
+    const size_t blockRows = std::clamp<size_t>(kBlockBytes / (k * sizeof(double)), 64, 4096);
+    const size_t stripeRows = blockRows * std::max<size_t>(1, kChunkSize / blockRows);
+    const auto kIndex = static_cast<Eigen::Index>(k);
+
+    // Without nulls both treatments give the same sums and share one entry
+    listwise = listwise && hasNulls;
+    std::string key(listwise ? "l" : "c");
+    for (const auto& name : columnNames) {
+        key += '\0' + name;
+    }
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->sync(*dataset);
+    if (cache->correlations.size() >= Cache::kMaxCorrelations && !cache->correlations.count(key)) {
+        cache->correlations.clear();
     }
-    return freqMap;
+    auto [entry, created] = cache->correlations.try_emplace(key);
+    Cache::Correlation& cached = entry->second;
+    const size_t complete = rows / stripeRows * stripeRows;
+
+    const CoMoments empty(k);
+    auto fold = [&](CoMoments& acc, size_t begin, size_t end) {
+        Eigen::MatrixXd block(static_cast<Eigen::Index>(blockRows), kIndex);
+        for (size_t r = begin; r < end; r += blockRows) {
+            auto m = static_cast<Eigen::Index>(std::min(blockRows, end - r));
+            for (size_t j = 0; j < k; ++j) {
+                fillRows(*sources[j], r, r + static_cast<size_t>(m), block.col(static_cast<Eigen::Index>(j)).data());
+            }
+            if (listwise) {
+                Eigen::Index kept = 0;
+                for (Eigen::Index i = 0; i < m; ++i) {
+                    if (!block.row(i).array().isNaN().any()) {
+                        if (kept != i) {
+                            block.row(kept) = block.row(i);
+                        }
+                        ++kept;
+                    }
+                }
+                m = kept;
+            }
+            acc.pushBlock(block.topRows(m));
+        }
+    };
+    if (created) {
+        cached.moments = empty;
+    }
+    foldStripes(cached.moments, empty, cached.rows, complete, stripeRows, threadCount, fold);
+    cached.rows = complete;
+    CoMoments total = cached.moments;
+    foldStripes(total, empty, complete, rows, stripeRows, threadCount, fold);
+    return total;
 }
 
 /**
@@ -110,34 +1269,120 @@ std::unordered_map<T, size_t> StatisticalAnalyzer::frequencyCount(const std::str
  * @return Eigen::MatrixXd containing the correlation coefficients
  * @throws std::invalid_argument if no columns are specified
  */
-Eigen::MatrixXd StatisticalAnalyzer::correlationMatrix(const std::vector<std::string>& columnNames) const {
+Eigen::MatrixXd StatisticalAnalyzer::correlationMatrix(const std::vector<std::string>& columnNames,
+                                                       bool upperTriangleOnly,
+                                                       MissingPolicy missing) const {
     if (columnNames.empty()) {
         throw std::invalid_argument("No columns specified for correlation analysis");
     }
 
-    size_t n = columnNames.size();
-    size_t rows = dataset->size();
-    
-    // Create matrix from data columns
-    Eigen::MatrixXd dataMatrix(rows, n);
-    for (size_t j = 0; j < n; ++j) {
-        std::vector<double> colData = dataset->getColumn<double>(columnNames[j]);
-        for (size_t i = 0; i < rows; ++i) {
-            dataMatrix(i, j) = colData[i];
+    const size_t k = columnNames.size();
+    const size_t rows = dataset->size();
+    std::vector<const Column*> sources(k);
+    bool hasNulls = false;
+    for (size_t j = 0; j < k; ++j) {
+        sources[j] = &dataset->column(columnNames[j]);
+        if (!sources[j]->isNumeric()) {
+            throw std::invalid_argument("Column '" + columnNames[j] + "' is not numeric");
         }
+        hasNulls = hasNulls || sources[j]->nullCount() > 0;
+    }
+    if (!hasNulls || missing != MissingPolicy::PairwiseComplete) {
+        return coMoments(columnNames, false).correlation(upperTriangleOnly);
     }
 
-    // Center the data
-    Eigen::MatrixXd centered = dataMatrix.rowwise() - dataMatrix.colwise().mean();
-    
-    // Compute covariance matrix
-    Eigen::MatrixXd cov = (centered.adjoint() * centered) / double(rows - 1);
-    
-    // Compute standard deviations
-    Eigen::VectorXd stdDev = cov.diagonal().array().sqrt();
-    
-    // Return correlation matrix
-    return cov.array() / (stdDev * stdDev.transpose()).array();
+    // Same blocks and stripes as coMoments()
+    const size_t blockRows = std::clamp<size_t>(kBlockBytes / (k * sizeof(double)), 64, 4096);
+    const size_t stripeRows = blockRows * std::max<size_t>(1, kChunkSize / blockRows);
+    const auto kIndex = static_cast<Eigen::Index>(k);
+
+    std::string key("p");
+    for (const auto& name : columnNames) {
+        key += '\0' + name;
+    }
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->sync(*dataset);
+    if (cache->correlations.size() >= Cache::kMaxCorrelations && !cache->correlations.count(key)) {
+        cache->correlations.clear();
+    }
+    auto [entry, created] = cache->correlations.try_emplace(key);
+    Cache::Correlation& cached = entry->second;
+    const size_t complete = rows / stripeRows * stripeRows;
+
+    // Pairwise complete: values are shifted by their column mean so the raw
+    // sums do not suffer from cancellation, and masked by the validity bitmaps
+    if (created) {
+        cached.centers.assign(k, 0.0);
+        parallelFor(k, threadCount, [&](size_t j) {
+            RunningStats stats;
+            forEachNumeric(*sources[j], [&stats](double v) { stats.push(v); });
+            cached.centers[j] = stats.count() ? stats.mean() : 0.0;
+        });
+        cached.pairwise = PairwiseMoments(k);
+    }
+    const std::vector<double>& centers = cached.centers;
+    const PairwiseMoments empty(k);
+    auto fold = [&](PairwiseMoments& acc, size_t begin, size_t end) {
+        Eigen::MatrixXd x(static_cast<Eigen::Index>(blockRows), kIndex);
+        Eigen::MatrixXd mask(static_cast<Eigen::Index>(blockRows), kIndex);
+        for (size_t r = begin; r < end; r += blockRows) {
+            const size_t m = std::min(blockRows, end - r);
+            for (size_t j = 0; j < k; ++j) {
+                const auto col = static_cast<Eigen::Index>(j);
+                fillMaskedRows(*sources[j], r, r + m, centers[j], x.col(col).data(), mask.col(col).data());
+            }
+            acc.pushBlock(x.topRows(static_cast<Eigen::Index>(m)), mask.topRows(static_cast<Eigen::Index>(m)));
+        }
+    };
+    foldStripes(cached.pairwise, empty, cached.rows, complete, stripeRows, threadCount, fold);
+    cached.rows = complete;
+    PairwiseMoments total = cached.pairwise;
+    foldStripes(total, empty, complete, rows, stripeRows, threadCount, fold);
+    return total.correlation(upperTriangleOnly);
+}
+
+/**
+ * @brief Fits a least-squares linear model over columns of the dataset
+ * @param response Column to explain
+ * @param predictors Columns explaining it
+ * @param ridge Ridge penalty (0 for OLS)
+ * @param intercept Whether to fit an intercept
+ * @return RegressionResult naming the predictors
+ */
+RegressionResult StatisticalAnalyzer::regression(const std::string& response, const std::vector<std::string>& predictors,
+                                                 double ridge, bool intercept) const {
+    if (predictors.empty()) {
+        throw std::invalid_argument("No predictors specified for regression");
+    }
+    std::vector<std::string> columns = predictors;
+    columns.push_back(response);
+    RegressionResult result = LinearRegression(coMoments(columns, true)).fit(ridge, intercept);
+    result.predictors = predictors;
+    return result;
+}
+
+/**
+ * @brief Computes Spearman's rank correlation matrix of columns
+ * @param columnNames Columns to correlate
+ * @param upperTriangleOnly If true, the strict lower triangle is left at zero
+ * @return Matrix of Spearman coefficients
+ */
+Eigen::MatrixXd StatisticalAnalyzer::spearmanCorrelationMatrix(const std::vector<std::string>& columnNames,
+                                                               bool upperTriangleOnly) const {
+    return rankCorrelationMatrix(*dataset, columnNames, upperTriangleOnly, threadCount,
+                                 [](const RankedColumn& x, const RankedColumn& y) { return spearmanCorrelation(x, y); });
+}
+
+/**
+ * @brief Computes the Kendall tau-b correlation matrix of columns
+ * @param columnNames Columns to correlate
+ * @param upperTriangleOnly If true, the strict lower triangle is left at zero
+ * @return Matrix of Kendall tau-b coefficients
+ */
+Eigen::MatrixXd StatisticalAnalyzer::kendallCorrelationMatrix(const std::vector<std::string>& columnNames,
+                                                              bool upperTriangleOnly) const {
+    return rankCorrelationMatrix(*dataset, columnNames, upperTriangleOnly, threadCount,
+                                 [](const RankedColumn& x, const RankedColumn& y) { return kendallTau(x, y); });
 }
 
 /**
@@ -149,7 +1394,7 @@ Eigen::MatrixXd StatisticalAnalyzer::correlationMatrix(const std::vector<std::st
 void StatisticalAnalyzer::reportStrongCorrelations(const std::vector<std::string>& columnNames, 
                                                   double threshold,
                                                   std::ostream& outStream) const {
-    Eigen::MatrixXd corrMatrix = correlationMatrix(columnNames);
+    Eigen::MatrixXd corrMatrix = correlationMatrix(columnNames, true);
     
     outStream << "Strong Correlations (|correlation| > " << threshold << "):\n";
     
@@ -168,9 +1413,17 @@ void StatisticalAnalyzer::reportStrongCorrelations(const std::vector<std::string
 
 template double StatisticalAnalyzer::mean<double>(const std::string&) const;
 template double StatisticalAnalyzer::median<double>(const std::string&) const;
+template std::vector<double> StatisticalAnalyzer::quantiles<double>(const std::string&, const std::vector<double>&) const;
+template double StatisticalAnalyzer::quantile<double>(const std::string&, double) const;
+template double StatisticalAnalyzer::percentile<double>(const std::string&, double) const;
+template double StatisticalAnalyzer::interquartileRange<double>(const std::string&) const;
 template double StatisticalAnalyzer::variance<double>(const std::string&) const;
 template double StatisticalAnalyzer::standardDeviation<double>(const std::string&) const;
 template std::unordered_map<double, size_t> StatisticalAnalyzer::frequencyCount<double>(const std::string&) const;
 template std::unordered_map<std::string, size_t> StatisticalAnalyzer::frequencyCount<std::string>(const std::string&) const;
+template FrequencyTable<double> StatisticalAnalyzer::frequencyTable<double>(const std::string&) const;
+template FrequencyTable<std::string> StatisticalAnalyzer::frequencyTable<std::string>(const std::string&) const;
+template std::vector<std::pair<double, size_t>> StatisticalAnalyzer::mostFrequent<double>(const std::string&, size_t) const;
+template std::vector<std::pair<std::string, size_t>> StatisticalAnalyzer::mostFrequent<std::string>(const std::string&, size_t) const;
 
 }
\ No newline at end of file
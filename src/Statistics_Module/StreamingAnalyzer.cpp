@@ -0,0 +1,185 @@
+#include "../../include/Statistics_Module/Streaming_analyzer.hpp"
+#include <cmath>
+
+namespace ScientificToolbox::Statistics {
+
+/**
+ * @brief Constructor for StreamingAnalyzer
+ * @param names Columns to track, or empty to track every numeric column
+ */
+StreamingAnalyzer::StreamingAnalyzer(std::vector<std::string> names)
+    : columnNames(std::move(names)) {
+    if (!columnNames.empty()) {
+        columnStats.resize(columnNames.size());
+        columnSketches.resize(columnNames.size());
+        columnDistinct.resize(columnNames.size());
+        coMoments = CoMoments(columnNames.size());
+    }
+}
+
+/**
+ * @brief Selects the numeric columns of the first batch when none were given
+ * @param batch First batch consumed
+ */
+void StreamingAnalyzer::initColumns(const Dataset& batch) {
+    for (const auto& name : batch.getColumnNames()) {
+        if (batch.isNumericColumn(name)) {
+            columnNames.push_back(name);
+        }
+    }
+    columnStats.resize(columnNames.size());
+    columnSketches.resize(columnNames.size());
+    columnDistinct.resize(columnNames.size());
+    coMoments = CoMoments(columnNames.size());
+}
+
+/**
+ * @brief Updates the accumulators with one batch of rows
+ * @param batch Batch of rows
+ * @throws std::runtime_error if a tracked column is missing or not numeric
+ */
+void StreamingAnalyzer::consume(const Dataset& batch) {
+    if (batch.empty()) {
+        return;
+    }
+    if (columnNames.empty()) {
+        initColumns(batch);
+    }
+
+    const size_t k = columnNames.size();
+    const size_t n = batch.size();
+    Eigen::MatrixXd block(n, k);
+    for (size_t j = 0; j < k; ++j) {
+        const Column& col = batch.column(columnNames[j]);
+        if (!col.isNumeric()) {
+            throw std::runtime_error("Column '" + columnNames[j] + "' is not numeric");
+        }
+        // Nulls come from the validity bitmap: a stored NaN is a value, as in StatisticalAnalyzer
+        std::vector<double> values = col.asDoubles();
+        for (size_t i = 0; i < n; ++i) {
+            if (col.isValid(i)) {
+                columnStats[j].push(values[i]);
+                columnSketches[j].update(values[i]);
+                columnDistinct[j].add(values[i]);
+            }
+            block(i, j) = values[i];
+        }
+    }
+
+    // Keep only the rows where every tracked column is present and not NaN, as StatisticalAnalyzer does
+    Eigen::Index complete = 0;
+    for (Eigen::Index i = 0; i < block.rows(); ++i) {
+        if (!block.row(i).array().isNaN().any()) {
+            if (complete != i) {
+                block.row(complete) = block.row(i);
+            }
+            ++complete;
+        }
+    }
+    coMoments.pushBlock(block.topRows(complete));
+    rowCount += n;
+}
+
+/**
+ * @brief Streams a CSV file through consume() in bounded memory
+ * @param filename Path of the CSV file
+ * @param batchRows Number of rows per batch
+ */
+void StreamingAnalyzer::processCSV(const std::string& filename, size_t batchRows) {
+    Dataset::streamCSV(filename, batchRows, [this](const Dataset& batch) { consume(batch); });
+}
+
+/**
+ * @brief Returns the accumulator of a tracked column
+ * @param columnName Name of the column
+ * @throws std::invalid_argument if the column is not tracked
+ */
+const RunningStats& StreamingAnalyzer::stats(const std::string& columnName) const {
+    return columnStats[columnIndex(columnName)];
+}
+
+/**
+ * @brief Returns the quantile sketch of a tracked column
+ * @param columnName Name of the column
+ * @throws std::invalid_argument if the column is not tracked
+ */
+const QuantileSketch& StreamingAnalyzer::sketch(const std::string& columnName) const {
+    return columnSketches[columnIndex(columnName)];
+}
+
+/**
+ * @brief Returns the distinct-count sketch of a tracked column
+ * @param columnName Name of the column
+ * @throws std::invalid_argument if the column is not tracked
+ */
+const CardinalitySketch& StreamingAnalyzer::distinctSketch(const std::string& columnName) const {
+    return columnDistinct[columnIndex(columnName)];
+}
+
+/**
+ * @brief Fits a linear model between tracked columns from the accumulated co-moments
+ * @param response Tracked column to explain
+ * @param predictors Tracked columns explaining it
+ * @param ridge Ridge penalty (0 for OLS)
+ * @param intercept Whether to fit an intercept
+ * @throws std::invalid_argument if a column is not tracked or no predictor is given
+ */
+RegressionResult StreamingAnalyzer::regression(const std::string& response, const std::vector<std::string>& predictors,
+                                               double ridge, bool intercept) const {
+    if (predictors.empty()) {
+        throw std::invalid_argument("No predictors specified for regression");
+    }
+    std::vector<size_t> variables;
+    for (const auto& name : predictors) {
+        variables.push_back(columnIndex(name));
+    }
+    variables.push_back(columnIndex(response));
+    RegressionResult result = LinearRegression(coMoments.select(variables)).fit(ridge, intercept);
+    result.predictors = predictors;
+    return result;
+}
+
+/**
+ * @brief Finds the position of a tracked column
+ * @param columnName Name of the column
+ * @throws std::invalid_argument if the column is not tracked
+ */
+size_t StreamingAnalyzer::columnIndex(const std::string& columnName) const {
+    for (size_t j = 0; j < columnNames.size(); ++j) {
+        if (columnNames[j] == columnName) {
+            return j;
+        }
+    }
+    throw std::invalid_argument("Column '" + columnName + "' is not tracked by the analyzer");
+}
+
+/**
+ * @brief Calculates the correlation matrix of the tracked columns
+ * @return Eigen::MatrixXd containing the correlation coefficients
+ */
+Eigen::MatrixXd StreamingAnalyzer::correlationMatrix() const {
+    return coMoments.correlation();
+}
+
+/**
+ * @brief Reports correlations above a certain threshold
+ * @param threshold Minimum absolute correlation value to report
+ * @param outStream Output stream to write results
+ */
+void StreamingAnalyzer::reportStrongCorrelations(double threshold, std::ostream& outStream) const {
+    Eigen::MatrixXd corrMatrix = correlationMatrix();
+
+    outStream << "Strong Correlations (|correlation| > " << threshold << "):\n";
+
+    for (int i = 0; i < corrMatrix.rows(); i++) {
+        for (int j = i + 1; j < corrMatrix.cols(); j++) {
+            double correlation = corrMatrix(i, j);
+            if (std::abs(correlation) > threshold) {
+                outStream << columnNames[i] << " - " << columnNames[j]
+                         << ": " << correlation << "\n";
+            }
+        }
+    }
+}
+
+} // namespace ScientificToolbox::Statistics
@@ -0,0 +1,104 @@
+#include "../../include/Statistics_Module/StringPool.hpp"
+#include <functional>
+#include <stdexcept>
+
+namespace ScientificToolbox::Statistics {
+
+namespace {
+
+inline uint32_t hashOf(std::string_view value) {
+    uint64_t h = std::hash<std::string_view>{}(value);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<uint32_t>(h);
+}
+
+} // namespace
+
+size_t StringPool::slotOf(std::string_view value, uint32_t hash) const {
+    const size_t mask = slots_.size() - 1;
+    size_t slot = hash & mask;
+    while (slots_[slot] != 0) {
+        uint32_t code = slots_[slot] - 1;
+        if (hashes_[code] == hash && (*this)[code] == value) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void StringPool::grow() {
+    slots_.assign(slots_.empty() ? 16 : 2 * slots_.size(), 0);
+    const size_t mask = slots_.size() - 1;
+    for (uint32_t code = 0; code < hashes_.size(); ++code) {
+        size_t slot = hashes_[code] & mask;
+        while (slots_[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots_[slot] = code + 1;
+    }
+}
+
+uint32_t StringPool::intern(std::string_view value) {
+    if (2 * (hashes_.size() + 1) > slots_.size()) {
+        grow();
+    }
+    const uint32_t hash = hashOf(value);
+    const size_t slot = slotOf(value, hash);
+    if (slots_[slot] != 0) {
+        return slots_[slot] - 1;
+    }
+    if (hashes_.size() >= npos - 1) {
+        throw std::length_error("Too many distinct strings in a column");
+    }
+    const auto code = static_cast<uint32_t>(hashes_.size());
+    chars_.insert(chars_.end(), value.begin(), value.end());
+    offsets_.push_back(chars_.size());
+    hashes_.push_back(hash);
+    slots_[slot] = code + 1;
+    return code;
+}
+
+uint32_t StringPool::find(std::string_view value) const {
+    if (slots_.empty()) {
+        return npos;
+    }
+    const size_t slot = slotOf(value, hashOf(value));
+    return slots_[slot] != 0 ? slots_[slot] - 1 : npos;
+}
+
+void StringPool::clear() {
+    chars_.clear();
+    offsets_.assign(1, 0);
+    hashes_.clear();
+    slots_.clear();
+}
+
+StringPool StringPool::fromArena(std::string_view chars, const uint64_t* offsets, size_t count) {
+    if (count > 0 && (offsets[0] != 0 || offsets[count] != chars.size())) {
+        throw std::invalid_argument("String offsets do not match the character data");
+    }
+    StringPool pool;
+    pool.chars_.reserve(chars.size());
+    pool.offsets_.reserve(count + 1);
+    pool.hashes_.reserve(count);
+    for (size_t c = 0; c < count; ++c) {
+        if (offsets[c + 1] < offsets[c]) {
+            throw std::invalid_argument("String offsets are not increasing");
+        }
+        auto value = chars.substr(offsets[c], offsets[c + 1] - offsets[c]);
+        if (pool.intern(value) != c) {
+            throw std::invalid_argument("Duplicate string in pool");
+        }
+    }
+    return pool;
+}
+
+size_t StringPool::memoryUsage() const {
+    return chars_.capacity() + offsets_.capacity() * sizeof(uint64_t) +
+           (hashes_.capacity() + slots_.capacity()) * sizeof(uint32_t);
+}
+
+} // namespace ScientificToolbox::Statistics
@@ -1,57 +1,591 @@
 #include "../../include/Statistics_Module/Dataset.hpp"
 #include "../../include/Statistics_Module/Statistical_analyzer.hpp"
+#include "../../include/Statistics_Module/Streaming_analyzer.hpp"
 
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h> 
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 namespace py = pybind11;
 
 using namespace ScientificToolbox::Statistics;
 
+namespace {
+
+/// Owner keeping a Python object alive from C++; released under the GIL
+std::shared_ptr<const void> keepAlive(py::object object) {
+    return std::shared_ptr<const void>(new py::object(std::move(object)), [](py::object* held) {
+        py::gil_scoped_acquire gil;
+        delete held;
+    });
+}
+
+/// Read-only NumPy array over memory kept alive by owner, without copying it
+template <typename T>
+py::array borrowedArray(const T* data, size_t count, std::shared_ptr<const void> owner) {
+    auto* held = new std::shared_ptr<const void>(std::move(owner));
+    py::capsule base(held, [](void* p) { delete static_cast<std::shared_ptr<const void>*>(p); });
+    py::array_t<T> array(static_cast<py::ssize_t>(count), data, base);
+    array.attr("setflags")(py::arg("write") = false);
+    return array;
+}
+
+/// NumPy array taking over a vector, without copying its elements
+template <typename T>
+py::array owningArray(std::vector<T> values) {
+    auto* held = new std::vector<T>(std::move(values));
+    py::capsule base(held, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+    return py::array_t<T>(static_cast<py::ssize_t>(held->size()), held->data(), base);
+}
+
+/**
+ * @brief One column as a NumPy array, one element per row
+ * 
+ * Double columns (whose null rows hold NaN) and Int columns without nulls are
+ * returned as read-only views of the column buffer, shared with the dataset so
+ * that later appends copy the column instead of invalidating the array. Int
+ * columns with nulls become float64 arrays with NaN, String and Mixed columns
+ * object arrays with None.
+ */
+py::array columnToNumpy(Dataset& dataset, const std::string& name) {
+    const Column& column = dataset.column(name);
+    const size_t n = column.size();
+    switch (column.type()) {
+        case ColumnType::Double: {
+            auto view = column.view<double>();
+            bool nullsAreNaN = true;
+            for (size_t i = 0; i < n && view.nullCount() > 0 && nullsAreNaN; ++i) {
+                nullsAreNaN = view.isValid(i) || std::isnan(view[i]);
+            }
+            if (nullsAreNaN) {
+                auto owner = dataset.shareColumn(name);
+                auto shared = dataset.getColumnView<double>(name);
+                return borrowedArray(shared.data(), shared.size(), std::move(owner));
+            }
+            break;
+        }
+        case ColumnType::Int:
+            if (column.nullCount() == 0) {
+                auto owner = dataset.shareColumn(name);
+                auto shared = dataset.getColumnView<int32_t>(name);
+                return borrowedArray(shared.data(), shared.size(), std::move(owner));
+            }
+            break;
+        case ColumnType::String:
+        case ColumnType::Mixed: {
+            py::list items(n);
+            for (size_t i = 0; i < n; ++i) {
+                auto value = column.at(i);
+                if (value) {
+                    items[i] = py::cast(*value);
+                } else {
+                    items[i] = py::none();
+                }
+            }
+            return py::array::ensure(py::module_::import("numpy").attr("array")(items, py::arg("dtype") = "object"));
+        }
+        case ColumnType::Empty:
+            break;
+    }
+    return owningArray(column.asDoubles());
+}
+
+/**
+ * @brief Builds a column from a one-dimensional array-like object
+ * 
+ * C-contiguous float64 and int32 arrays are borrowed without copying (NaN
+ * marks nulls); other numeric arrays are converted once, to int32 when every
+ * value fits and to double otherwise. Other arrays go element by element:
+ * None, NaN and pandas.NA become nulls, str values strings.
+ */
+Column columnFromArray(const py::handle& object) {
+    py::array array = py::array::ensure(object);
+    if (!array) {
+        throw std::invalid_argument("Column is not array-like");
+    }
+    if (array.ndim() != 1) {
+        throw std::invalid_argument("Columns must be one-dimensional arrays");
+    }
+    const size_t n = static_cast<size_t>(array.size());
+    const char kind = array.dtype().kind();
+
+    if (kind == 'f' || (kind == 'u' && array.itemsize() == 8)) {
+        auto values = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure(array);
+        const double* data = values.data();
+        std::vector<uint64_t> validity((n + 63) / 64, 0);
+        size_t nulls = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (std::isnan(data[i])) {
+                ++nulls;
+            } else {
+                validity[i >> 6] |= uint64_t{1} << (i & 63);
+            }
+        }
+        return Column::fromBuffers(Buffer<double>(data, n, keepAlive(values)),
+                                   nulls ? Buffer<uint64_t>(std::move(validity)) : Buffer<uint64_t>(), nulls);
+    }
+    if (py::isinstance<py::array_t<int32_t>>(array)) {
+        auto values = py::array_t<int32_t, py::array::c_style | py::array::forcecast>::ensure(array);
+        return Column::fromBuffers(Buffer<int32_t>(values.data(), n, keepAlive(values)), Buffer<uint64_t>(), 0);
+    }
+    if (kind == 'i' || kind == 'u' || kind == 'b') {
+        auto values = py::array_t<int64_t, py::array::c_style | py::array::forcecast>::ensure(array);
+        const int64_t* data = values.data();
+        bool fits = std::all_of(data, data + n, [](int64_t v) {
+            return v >= std::numeric_limits<int32_t>::min() && v <= std::numeric_limits<int32_t>::max();
+        });
+        if (fits) {
+            return Column::fromBuffers(Buffer<int32_t>(std::vector<int32_t>(data, data + n)), Buffer<uint64_t>(), 0);
+        }
+        return Column::fromBuffers(Buffer<double>(std::vector<double>(data, data + n)), Buffer<uint64_t>(), 0);
+    }
+
+    Column column;
+    column.reserve(n);
+    py::array objects = py::array::ensure(array.attr("astype")("object"));
+    for (py::handle item : objects) {
+        if (item.is_none() || py::str(py::type::of(item).attr("__name__")).cast<std::string>() == "NAType") {
+            column.appendNull();
+        } else if (py::isinstance<py::str>(item)) {
+            column.appendString(item.cast<std::string>());
+        } else if (py::isinstance<py::bool_>(item) || py::isinstance<py::int_>(item)) {
+            long long v = item.cast<long long>();
+            if (v >= std::numeric_limits<int32_t>::min() && v <= std::numeric_limits<int32_t>::max()) {
+                column.appendInt(static_cast<int32_t>(v));
+            } else {
+                column.appendDouble(static_cast<double>(v));
+            }
+        } else if (py::isinstance<py::float_>(item)) {
+            double v = item.cast<double>();
+            if (std::isnan(v)) {
+                column.appendNull();
+            } else {
+                column.appendDouble(v);
+            }
+        } else {
+            column.appendString(py::str(item).cast<std::string>());
+        }
+    }
+    return column;
+}
+
+} // namespace
+
 
 PYBIND11_MODULE(_stats, m) {
     m.doc() = R"pbdoc(
                         Python bindings for the statistics module providing Dataset and StatisticalAnalyzer functionalities.)pbdoc";
 
+    py::enum_<ScientificToolbox::FieldType>(m, "FieldType", R"pbdoc(
+                        Type a CSV column is parsed as; Auto classifies every cell on its own.)pbdoc")
+        .value("Auto", ScientificToolbox::FieldType::Auto)
+        .value("Int", ScientificToolbox::FieldType::Int)
+        .value("Double", ScientificToolbox::FieldType::Double)
+        .value("String", ScientificToolbox::FieldType::String);
+
+    auto importOptions = [](size_t sampleRows, const std::unordered_map<std::string, ScientificToolbox::FieldType>& types,
+                            const std::vector<std::string>& columns) {
+        ScientificToolbox::ImportOptions options;
+        options.sampleRows = sampleRows;
+        options.types = types;
+        options.columns = columns;
+        return options;
+    };
+
     py::class_<Dataset, std::shared_ptr<Dataset>>(m, "Dataset", R"pbdoc(
                         Represents a dataset for statistical analysis.)pbdoc")
         .def(py::init<>(), R"pbdoc(
                         Creates an empty Dataset.)pbdoc")
+        .def_static("fromCSV", [importOptions](const std::string& filename, unsigned threads, size_t sampleRows,
+                                               const std::unordered_map<std::string, ScientificToolbox::FieldType>& types,
+                                               const std::vector<std::string>& columns) {
+                        return Dataset::fromCSV(filename, threads, importOptions(sampleRows, types, columns));
+                    }, py::arg("filename"), py::arg("threads") = 1, py::arg("sampleRows") = 1000,
+                    py::arg("types") = std::unordered_map<std::string, ScientificToolbox::FieldType>(),
+                    py::arg("columns") = std::vector<std::string>(), R"pbdoc(
+                        Loads a CSV file into a new Dataset using the memory-mapped importer,
+                        parsing it on the given number of threads. Column types are inferred
+                        from the first sampleRows records; types maps column names to forced FieldTypes;
+                        columns restricts the import to those columns, the others are never parsed.)pbdoc")
+        .def_static("fromSnapshot", &Dataset::fromSnapshot, py::arg("filename"), R"pbdoc(
+                        Opens a binary snapshot written by save(), memory-mapping its column buffers.)pbdoc")
+        .def_static("load", [importOptions](const std::string& filename, unsigned threads, size_t sampleRows,
+                                            const std::unordered_map<std::string, ScientificToolbox::FieldType>& types,
+                                               const std::vector<std::string>& columns) {
+                        return Dataset::load(filename, threads, importOptions(sampleRows, types, columns));
+                    }, py::arg("filename"), py::arg("threads") = 1, py::arg("sampleRows") = 1000,
+                    py::arg("types") = std::unordered_map<std::string, ScientificToolbox::FieldType>(),
+                    py::arg("columns") = std::vector<std::string>(), R"pbdoc(
+                        Loads a snapshot or a CSV file, detected from the file contents.)pbdoc")
+        .def("save", &Dataset::save, py::arg("filename"), R"pbdoc(
+                        Writes the Dataset to a binary columnar snapshot.)pbdoc")
         .def("addRow", &Dataset::addRow, R"pbdoc(
                         Adds a new row to the Dataset. All columns must match existing structure.)pbdoc")
-        .def("getColumn", &Dataset::getColumn<double>, R"pbdoc(
-                        Gets the specified column as a vector of doubles.)pbdoc")
-        .def("getColumn", &Dataset::getColumn<int>, R"pbdoc(
-                        Gets the specified column as a vector of ints.)pbdoc")
-        .def("getColumn", &Dataset::getColumn<std::string>, R"pbdoc(
-                        Gets the specified column as a vector of strings.)pbdoc")
+        .def("addRows", &Dataset::addRows, py::arg("columns"), py::arg("rows"), R"pbdoc(
+                        Appends rows given as lists of values in the order of columns, which must
+                        name every column once. The names are checked once for the whole batch.)pbdoc")
+        .def("appendNumpy", [](Dataset& self, const py::dict& columns) {
+                 Dataset::ColumnBatch batch;
+                 for (auto item : columns) {
+                     batch.emplace_back(py::cast<std::string>(item.first), columnFromArray(item.second));
+                 }
+                 self.appendBatch(std::move(batch));
+             }, py::arg("columns"), R"pbdoc(
+                        Appends a batch of rows given as a dict of equal-length arrays, one per
+                        column, converted as in fromNumpy. Each array is appended to its column
+                        buffer in one copy.)pbdoc")
+        .def("getColumn", [](Dataset& self, const std::string& name) -> py::object {
+                 const Column& column = self.column(name);
+                 if (column.type() == ColumnType::String) {
+                     return py::cast(self.getColumn<std::string>(name));
+                 }
+                 if (column.type() == ColumnType::Double && column.nullCount() == 0) {
+                     return columnToNumpy(self, name);
+                 }
+                 return owningArray(self.getColumn<double>(name));
+             }, py::arg("column"), R"pbdoc(
+                        Gets the non-null values of the specified column: a float64 NumPy array
+                        for numeric columns (a read-only view of the column buffer when the column
+                        holds doubles without nulls), a list of str for string columns.)pbdoc")
+        .def("toNumpy", &columnToNumpy, py::arg("column"), R"pbdoc(
+                        Returns the specified column as a NumPy array with one element per row.
+                        float64 columns and int32 columns without nulls are read-only views of the
+                        column buffer, kept valid if rows are appended later; other numeric columns
+                        are float64 copies with NaN for nulls, string columns object arrays with None.)pbdoc")
+        .def("toNumpy", [](Dataset& self) {
+                 py::dict out;
+                 for (const auto& name : self.getColumnNames()) {
+                     out[py::str(name)] = columnToNumpy(self, name);
+                 }
+                 return out;
+             }, R"pbdoc(
+                        Returns every column as a NumPy array, in a dict keyed by column name.)pbdoc")
+        .def_static("fromNumpy", [](const py::dict& columns) {
+                        Dataset out;
+                        for (auto item : columns) {
+                            out.addColumn(py::cast<std::string>(item.first), columnFromArray(item.second));
+                        }
+                        return out;
+                    }, py::arg("columns"), R"pbdoc(
+                        Builds a Dataset from a dict of equal-length one-dimensional arrays, e.g.
+                        {name: df[name].to_numpy() for name in df.columns}. C-contiguous float64 and
+                        int32 arrays are borrowed without copying (NaN marks nulls) and kept alive by
+                        the Dataset, so they must not be modified afterwards; other integer arrays are converted once, and object or str arrays
+                        are read element by element (None, NaN and pandas.NA are nulls).)pbdoc")
         .def("isNumeric", &Dataset::isNumericColumn, R"pbdoc(
                         Checks if the specified column contains only numeric data.)pbdoc")
         .def("getColumnNames", &Dataset::getColumnNames, R"pbdoc(
                         Returns the names of all columns in the Dataset.)pbdoc")
         .def("size", &Dataset::size, R"pbdoc(
-                        Returns the number of rows in the Dataset.)pbdoc");
+                        Returns the number of rows in the Dataset.)pbdoc")
+        .def("memoryUsage", &Dataset::memoryUsage, R"pbdoc(
+                        Returns the approximate memory used by the column buffers, in bytes.)pbdoc");
+
+    py::class_<QuantileSketch>(m, "QuantileSketch", R"pbdoc(
+                        Mergeable approximate quantile sketch (KLL) with bounded memory.)pbdoc")
+        .def(py::init<uint16_t>(), py::arg("k") = 200, R"pbdoc(
+                        Creates an empty sketch; larger k gives smaller rank error.)pbdoc")
+        .def("update", &QuantileSketch::update, R"pbdoc(
+                        Adds one value to the sketch.)pbdoc")
+        .def("merge", &QuantileSketch::merge, R"pbdoc(
+                        Merges another sketch built with the same k.)pbdoc")
+        .def("count", &QuantileSketch::count, R"pbdoc(
+                        Returns the number of values summarized.)pbdoc")
+        .def("quantile", &QuantileSketch::quantile, R"pbdoc(
+                        Returns the approximate quantile for a probability in [0, 1].)pbdoc")
+        .def("quantiles", &QuantileSketch::quantiles, R"pbdoc(
+                        Returns approximate quantiles for several probabilities.)pbdoc")
+        .def("rank", &QuantileSketch::rank, R"pbdoc(
+                        Returns the approximate fraction of values less than or equal to a value.)pbdoc")
+        .def("serialize",
+             [](const QuantileSketch& self) { return py::bytes(self.serialize()); },
+             R"pbdoc(
+                        Serializes the sketch to bytes.)pbdoc")
+        .def_static("deserialize",
+             [](const py::bytes& data) { return QuantileSketch::deserialize(std::string(data)); },
+             R"pbdoc(
+                        Rebuilds a sketch from serialized bytes.)pbdoc");
+
+    py::class_<CardinalitySketch>(m, "CardinalitySketch", R"pbdoc(
+                        Mergeable distinct-count sketch (HyperLogLog), exact for small counts.)pbdoc")
+        .def(py::init<uint8_t>(), py::arg("precision") = 14, R"pbdoc(
+                        Creates an empty sketch with 2^precision registers, precision in [4, 18].)pbdoc")
+        .def("add", py::overload_cast<double>(&CardinalitySketch::add), py::arg("value"), R"pbdoc(
+                        Adds one number; an int and the equal float count once.)pbdoc")
+        .def("add", py::overload_cast<std::string_view>(&CardinalitySketch::add), py::arg("value"), R"pbdoc(
+                        Adds one string.)pbdoc")
+        .def("add", [](CardinalitySketch& self, py::array_t<double, py::array::c_style | py::array::forcecast> values) {
+                 if (values.ndim() != 1) {
+                     throw std::invalid_argument("Values must be one-dimensional");
+                 }
+                 self.add(values.data(), static_cast<size_t>(values.size()));
+             }, py::arg("values"), R"pbdoc(
+                        Adds an array of numbers (converted to float64 if needed).)pbdoc")
+        .def("merge", &CardinalitySketch::merge, R"pbdoc(
+                        Merges another sketch built with the same precision.)pbdoc")
+        .def("estimate", &CardinalitySketch::estimate, R"pbdoc(
+                        Returns the estimated number of distinct values added.)pbdoc")
+        .def("isExact", &CardinalitySketch::isExact, R"pbdoc(
+                        Returns True while the sketch still counts exactly.)pbdoc")
+        .def("precision", &CardinalitySketch::precision, R"pbdoc(
+                        Returns log2 of the number of registers.)pbdoc")
+        .def("standardError", &CardinalitySketch::standardError, R"pbdoc(
+                        Returns the relative standard error of the estimate once it is not exact.)pbdoc")
+        .def("serialize",
+             [](const CardinalitySketch& self) { return py::bytes(self.serialize()); },
+             R"pbdoc(
+                        Serializes the sketch to bytes.)pbdoc")
+        .def_static("deserialize",
+             [](const py::bytes& data) { return CardinalitySketch::deserialize(std::string(data)); },
+             R"pbdoc(
+                        Rebuilds a sketch from serialized bytes.)pbdoc");
+
+    py::class_<Histogram> histogram(m, "Histogram", R"pbdoc(
+                        Mergeable histogram over linear, log-scale or explicit bins, with
+                        underflow, overflow and NaN counts.)pbdoc");
+    py::enum_<Histogram::Scale>(histogram, "Scale")
+        .value("Linear", Histogram::Scale::Linear)
+        .value("Log", Histogram::Scale::Log)
+        .value("Edges", Histogram::Scale::Edges);
+    histogram
+        .def_static("linear", &Histogram::linear, py::arg("lo"), py::arg("hi"), py::arg("bins"), R"pbdoc(
+                        Creates a histogram with equal-width bins over [lo, hi].)pbdoc")
+        .def_static("logarithmic", &Histogram::logarithmic, py::arg("lo"), py::arg("hi"), py::arg("bins"), R"pbdoc(
+                        Creates a histogram with bins of equal width in log scale over [lo, hi], 0 < lo.)pbdoc")
+        .def_static("fromEdges", &Histogram::fromEdges, py::arg("edges"), R"pbdoc(
+                        Creates a histogram with bins between strictly increasing edges.)pbdoc")
+        .def("add", [](Histogram& self, py::array_t<double, py::array::c_style | py::array::forcecast> values) {
+                 if (values.ndim() != 1) {
+                     throw std::invalid_argument("Values must be one-dimensional");
+                 }
+                 self.add(values.data(), static_cast<size_t>(values.size()));
+             }, py::arg("values"), R"pbdoc(
+                        Adds an array of values (converted to float64 if needed).)pbdoc")
+        .def("merge", &Histogram::merge, py::arg("other"), R"pbdoc(
+                        Adds the counts of a histogram with the same bins.)pbdoc")
+        .def("clear", &Histogram::clear, R"pbdoc(
+                        Resets every count to zero, keeping the bins.)pbdoc")
+        .def("scale", &Histogram::scale, R"pbdoc(
+                        Returns how the bins are laid out.)pbdoc")
+        .def("bins", &Histogram::bins, R"pbdoc(
+                        Returns the number of bins.)pbdoc")
+        .def("edges", [](const Histogram& self) { return owningArray(self.edges()); }, R"pbdoc(
+                        Returns the bins() + 1 bin edges as a float64 array.)pbdoc")
+        .def("counts", [](const Histogram& self) { return owningArray(self.counts()); }, R"pbdoc(
+                        Returns the count of each bin as a uint64 array.)pbdoc")
+        .def("underflow", &Histogram::underflow, R"pbdoc(
+                        Returns the number of values below the first edge.)pbdoc")
+        .def("overflow", &Histogram::overflow, R"pbdoc(
+                        Returns the number of values above the last edge.)pbdoc")
+        .def("nanCount", &Histogram::nanCount, R"pbdoc(
+                        Returns the number of NaN values.)pbdoc")
+        .def("total", &Histogram::total, R"pbdoc(
+                        Returns the number of values inside the bins.)pbdoc")
+        .def("quantile", &Histogram::quantile, py::arg("probability"), R"pbdoc(
+                        Returns an approximate quantile of the values inside the bins, interpolated
+                        within the bin holding it.)pbdoc");
+
+    py::enum_<Binning>(m, "Binning", R"pbdoc(
+                        How StatisticalAnalyzer.histogram places the bins of a column.)pbdoc")
+        .value("Linear", Binning::Linear)
+        .value("Log", Binning::Log)
+        .value("Quantile", Binning::Quantile);
+
+    py::enum_<MissingPolicy>(m, "MissingPolicy", R"pbdoc(
+                        Treatment of null values by correlation methods.)pbdoc")
+        .value("Propagate", MissingPolicy::Propagate)
+        .value("PairwiseComplete", MissingPolicy::PairwiseComplete);
+
+    py::class_<GroupBy>(m, "GroupBy", R"pbdoc(
+                        Rows of a Dataset grouped by key columns, returned by StatisticalAnalyzer.groupBy.)pbdoc")
+        .def("groups", &GroupBy::groups, R"pbdoc(
+                        Returns the number of groups.)pbdoc")
+        .def("size", &GroupBy::size, R"pbdoc(
+                        Returns a Dataset with the key columns and the number of rows of each group.)pbdoc")
+        .def("agg",
+             [](const GroupBy& self, const py::dict& spec) {
+                 AggregationSpec parsed;
+                 for (auto item : spec) {
+                     std::vector<Aggregate> aggregates;
+                     for (auto name : py::reinterpret_borrow<py::iterable>(item.second)) {
+                         aggregates.push_back(Aggregate::parse(py::cast<std::string>(name)));
+                     }
+                     parsed.emplace_back(py::cast<std::string>(item.first), std::move(aggregates));
+                 }
+                 return self.agg(parsed);
+             },
+             py::arg("spec"), R"pbdoc(
+                        Computes aggregates per group, e.g. agg({"Calories": ["mean", "var", "count", "p90"]}).
+                        Aggregates: count, sum, mean, var, std, min, max, median and pNN (percentile).
+                        Returns a Dataset with the key columns and one "<column>_<aggregate>" column each.)pbdoc");
+
+    py::class_<Selection>(m, "Selection", R"pbdoc(
+                        Bitmap of selected rows, returned by Filter.evaluate.)pbdoc")
+        .def(py::init<size_t, bool>(), py::arg("rows"), py::arg("all") = false)
+        .def("rows", &Selection::rows, R"pbdoc(
+                        Returns the number of rows covered by the selection.)pbdoc")
+        .def("count", &Selection::count, R"pbdoc(
+                        Returns the number of selected rows.)pbdoc")
+        .def("contains", &Selection::contains, py::arg("row"))
+        .def("indices", &Selection::indices, R"pbdoc(
+                        Returns the indices of the selected rows in increasing order.)pbdoc")
+        .def("__and__", [](const Selection& a, const Selection& b) { return a & b; })
+        .def("__or__", [](const Selection& a, const Selection& b) { return a | b; })
+        .def("__invert__", [](const Selection& a) { return ~a; });
+
+    py::class_<Filter>(m, "Filter", R"pbdoc(
+                        Row predicate over the columns of a Dataset, combined with &, | and ~.
+                        Comparisons never select null rows.)pbdoc")
+        .def_static("equal", &Filter::equal, py::arg("column"), py::arg("value"))
+        .def_static("notEqual", &Filter::notEqual, py::arg("column"), py::arg("value"))
+        .def_static("less", &Filter::less, py::arg("column"), py::arg("value"))
+        .def_static("lessEqual", &Filter::lessEqual, py::arg("column"), py::arg("value"))
+        .def_static("greater", &Filter::greater, py::arg("column"), py::arg("value"))
+        .def_static("greaterEqual", &Filter::greaterEqual, py::arg("column"), py::arg("value"))
+        .def_static("between", &Filter::between, py::arg("column"), py::arg("lo"), py::arg("hi"), R"pbdoc(
+                        Rows with lo <= value <= hi.)pbdoc")
+        .def_static("isIn", &Filter::isIn, py::arg("column"), py::arg("values"))
+        .def_static("isNull", &Filter::isNull, py::arg("column"))
+        .def_static("notNull", &Filter::notNull, py::arg("column"))
+        .def("__and__", &Filter::operator&)
+        .def("__or__", &Filter::operator|)
+        .def("__invert__", [](const Filter& f) { return ~f; })
+        .def("evaluate", &Filter::evaluate, py::arg("dataset"), py::arg("threads") = 1, R"pbdoc(
+                        Returns the Selection of rows of the dataset matching the filter.)pbdoc");
+
+    py::class_<ColumnSummary>(m, "ColumnSummary", R"pbdoc(
+                        Descriptive statistics of one column returned by StatisticalAnalyzer.describe.)pbdoc")
+        .def_readonly("column", &ColumnSummary::column)
+        .def_readonly("count", &ColumnSummary::count)
+        .def_readonly("mean", &ColumnSummary::mean)
+        .def_readonly("variance", &ColumnSummary::variance)
+        .def_readonly("standardDeviation", &ColumnSummary::standardDeviation)
+        .def_readonly("min", &ColumnSummary::min)
+        .def_readonly("max", &ColumnSummary::max)
+        .def_readonly("probabilities", &ColumnSummary::probabilities)
+        .def_readonly("quantiles", &ColumnSummary::quantiles);
+
+    py::class_<RegressionResult>(m, "RegressionResult", R"pbdoc(
+                        Fitted linear model returned by regression and LinearRegression.fit.)pbdoc")
+        .def_readonly("predictors", &RegressionResult::predictors)
+        .def_readonly("coefficients", &RegressionResult::coefficients)
+        .def_readonly("standardErrors", &RegressionResult::standardErrors)
+        .def_readonly("intercept", &RegressionResult::intercept)
+        .def_readonly("interceptStandardError", &RegressionResult::interceptStandardError)
+        .def_readonly("rSquared", &RegressionResult::rSquared)
+        .def_readonly("adjustedRSquared", &RegressionResult::adjustedRSquared)
+        .def_readonly("residualStandardError", &RegressionResult::residualStandardError)
+        .def_readonly("observations", &RegressionResult::observations)
+        .def_readonly("ridge", &RegressionResult::ridge);
+
+    py::class_<LinearRegression>(m, "LinearRegression", R"pbdoc(
+                        Single-pass, mergeable least-squares regression over row batches,
+                        keeping O(predictors^2) state whatever the number of rows.)pbdoc")
+        .def(py::init<size_t>(), py::arg("predictors"), R"pbdoc(
+                        Creates an empty accumulator for the given number of predictors.)pbdoc")
+        .def("push", &LinearRegression::push, py::arg("x"), py::arg("y"), R"pbdoc(
+                        Adds one row; ignored if it holds a NaN.)pbdoc")
+        .def("pushBlock", &LinearRegression::pushBlock, py::arg("rows"), R"pbdoc(
+                        Adds a block of rows: predictors then the response in the last column;
+                        rows holding a NaN are skipped.)pbdoc")
+        .def("merge", &LinearRegression::merge, py::arg("other"), R"pbdoc(
+                        Combines another accumulator over the same predictors into this one.)pbdoc")
+        .def("count", &LinearRegression::count, R"pbdoc(
+                        Returns the number of complete rows added.)pbdoc")
+        .def("predictors", &LinearRegression::predictors, R"pbdoc(
+                        Returns the number of predictors.)pbdoc")
+        .def("fit", &LinearRegression::fit, py::arg("ridge") = 0.0, py::arg("intercept") = true, R"pbdoc(
+                        Solves the least-squares problem (ridge penalty 0 for OLS).)pbdoc");
 
     py::class_<StatisticalAnalyzer>(m, "StatisticalAnalyzer", R"pbdoc(
                         Performs statistical computations on a Dataset.)pbdoc")
-        .def(py::init<std::shared_ptr<Dataset>>(), R"pbdoc(
-                        Constructs a StatisticalAnalyzer with the given Dataset.)pbdoc")
+        .def(py::init<std::shared_ptr<Dataset>, unsigned>(), py::arg("dataset"), py::arg("threads") = 1, R"pbdoc(
+                        Constructs a StatisticalAnalyzer with the given Dataset, running
+                        on the given number of threads (0 for one per hardware thread).)pbdoc")
+        .def_property("threads", &StatisticalAnalyzer::threads, &StatisticalAnalyzer::setThreads, R"pbdoc(
+                        Number of threads used by the analysis; results do not depend on it.)pbdoc")
         .def("mean", &StatisticalAnalyzer::mean<double>, R"pbdoc(
                         Computes the mean of the specified column.)pbdoc")
         .def("median", &StatisticalAnalyzer::median<double>, R"pbdoc(
                         Computes the median of the specified column.)pbdoc")
+        .def("quantiles", &StatisticalAnalyzer::quantiles<double>, R"pbdoc(
+                        Computes several quantiles of the specified column by selection.)pbdoc")
+        .def("quantile", &StatisticalAnalyzer::quantile<double>, R"pbdoc(
+                        Computes one quantile (probability in [0, 1]) of the specified column.)pbdoc")
+        .def("percentile", &StatisticalAnalyzer::percentile<double>, R"pbdoc(
+                        Computes one percentile (in [0, 100]) of the specified column.)pbdoc")
+        .def("interquartileRange", &StatisticalAnalyzer::interquartileRange<double>, R"pbdoc(
+                        Computes the interquartile range of the specified column.)pbdoc")
+        .def("quantileSketch", &StatisticalAnalyzer::quantileSketch, py::arg("columnName"), py::arg("k") = 200, R"pbdoc(
+                        Builds a mergeable quantile sketch over the specified column.)pbdoc")
+        .def("cardinalitySketch", &StatisticalAnalyzer::cardinalitySketch,
+             py::arg("columnName"), py::arg("precision") = 14, R"pbdoc(
+                        Builds a mergeable distinct-count sketch over the specified column.)pbdoc")
+        .def("approxDistinctCount", &StatisticalAnalyzer::approxDistinctCount,
+             py::arg("columnName"), py::arg("precision") = 14, R"pbdoc(
+                        Estimates the number of distinct non-null values of the specified column.)pbdoc")
+        .def("histogram",
+             py::overload_cast<const std::string&, size_t, Binning>(&StatisticalAnalyzer::histogram, py::const_),
+             py::arg("columnName"), py::arg("bins"), py::arg("binning") = Binning::Linear, R"pbdoc(
+                        Builds a histogram of the specified column with bins fitted to its values.)pbdoc")
+        .def("histogram",
+             py::overload_cast<const std::string&, Histogram>(&StatisticalAnalyzer::histogram, py::const_),
+             py::arg("columnName"), py::arg("bins"), R"pbdoc(
+                        Adds the values of the specified column to a copy of a histogram with given bins.)pbdoc")
+        .def("approxQuantile", &StatisticalAnalyzer::approxQuantile,
+             py::arg("columnName"), py::arg("probability"), py::arg("k") = 200, R"pbdoc(
+                        Computes an approximate quantile of the specified column from a sketch.)pbdoc")
+        .def("approxMedian", &StatisticalAnalyzer::approxMedian, py::arg("columnName"), py::arg("k") = 200, R"pbdoc(
+                        Computes an approximate median of the specified column from a sketch.)pbdoc")
         .def("variance", &StatisticalAnalyzer::variance<double>, R"pbdoc(
                         Computes the variance of the specified column.)pbdoc")
         .def("standardDeviation", &StatisticalAnalyzer::standardDeviation<double>, R"pbdoc(
                         Computes the standard deviation of the specified column.)pbdoc")
+        .def("describe", &StatisticalAnalyzer::describe,
+             py::arg("columnNames"),
+             py::arg("probabilities") = std::vector<double>{0.25, 0.5, 0.75}, R"pbdoc(
+                        Computes count, mean, variance, standard deviation, min, max and quantiles
+                        of each column from a single extraction.)pbdoc")
         .def("frequencyCount", &StatisticalAnalyzer::frequencyCount<double>, R"pbdoc(
                         Calculates the frequency distribution for numeric columns.)pbdoc")
         .def("frequencyCountStr", &StatisticalAnalyzer::frequencyCount<std::string>, R"pbdoc(
                         Calculates the frequency distribution for string columns.)pbdoc")
-        .def("correlationMatrix", &StatisticalAnalyzer::correlationMatrix, R"pbdoc(
-                        Generates a correlation matrix for the specified columns.)pbdoc")
+        .def("mostFrequent", &StatisticalAnalyzer::mostFrequent<double>, py::arg("columnName"), py::arg("k"), R"pbdoc(
+                        Returns the k most frequent values of a numeric column as (value, count) pairs.)pbdoc")
+        .def("mostFrequentStr", &StatisticalAnalyzer::mostFrequent<std::string>, py::arg("columnName"), py::arg("k"), R"pbdoc(
+                        Returns the k most frequent values of a string column as (value, count) pairs.)pbdoc")
+        .def("groupBy", &StatisticalAnalyzer::groupBy, py::arg("keys"), R"pbdoc(
+                        Groups the rows of the dataset by the given key columns (see GroupBy.agg).)pbdoc")
+        .def("where", py::overload_cast<const Filter&>(&StatisticalAnalyzer::where, py::const_),
+             py::arg("filter"), R"pbdoc(
+                        Returns an analyzer over the rows matching the filter, sharing the
+                        column buffers of this one (unselected rows read as nulls).)pbdoc")
+        .def("where", py::overload_cast<const Selection&>(&StatisticalAnalyzer::where, py::const_),
+             py::arg("rows"))
+        .def("correlationMatrix", &StatisticalAnalyzer::correlationMatrix,
+             py::arg("columnNames"), py::arg("upperTriangleOnly") = false,
+             py::arg("missing") = MissingPolicy::PairwiseComplete, R"pbdoc(
+                        Generates a correlation matrix for the specified columns, streaming
+                        row blocks across the analyzer's threads. With upperTriangleOnly the
+                        strict lower triangle is left at zero. By default each pair of columns
+                        uses the rows where both values are present.)pbdoc")
+        .def("regression", &StatisticalAnalyzer::regression,
+             py::arg("response"), py::arg("predictors"), py::arg("ridge") = 0.0, py::arg("intercept") = true, R"pbdoc(
+                        Fits response ~ predictors by least squares (ridge penalty 0 for OLS)
+                        over the rows where every column is present.)pbdoc")
+        .def("spearmanCorrelationMatrix", &StatisticalAnalyzer::spearmanCorrelationMatrix,
+             py::arg("columnNames"), py::arg("upperTriangleOnly") = false, R"pbdoc(
+                        Generates Spearman's rank correlation matrix of the specified columns
+                        over the rows where all of them are present.)pbdoc")
+        .def("kendallCorrelationMatrix", &StatisticalAnalyzer::kendallCorrelationMatrix,
+             py::arg("columnNames"), py::arg("upperTriangleOnly") = false, R"pbdoc(
+                        Generates the Kendall tau-b correlation matrix of the specified columns
+                        over the rows where all of them are present (O(n log n) per pair).)pbdoc")
         .def("reportStrongCorrelations",
              [](StatisticalAnalyzer& self, const std::vector<std::string>& columnNames, double threshold) {
                  std::stringstream ss;
@@ -62,4 +596,50 @@ PYBIND11_MODULE(_stats, m) {
              py::arg("threshold") = 0.7,
              R"pbdoc(
                         Reports columns with absolute correlation above the given threshold.)pbdoc");
+
+    py::class_<StreamingAnalyzer>(m, "StreamingAnalyzer", R"pbdoc(
+                        Computes statistics over row batches in bounded memory.)pbdoc")
+        .def(py::init<std::vector<std::string>>(), py::arg("columnNames") = std::vector<std::string>{}, R"pbdoc(
+                        Constructs a StreamingAnalyzer tracking the given columns (all numeric ones if empty).)pbdoc")
+        .def("consume", &StreamingAnalyzer::consume, R"pbdoc(
+                        Folds a Dataset batch into the running accumulators.)pbdoc")
+        .def("processCSV", &StreamingAnalyzer::processCSV, py::arg("filename"), py::arg("batchRows") = 65536, R"pbdoc(
+                        Streams a CSV file through the accumulators in batches of rows.)pbdoc")
+        .def("columns", &StreamingAnalyzer::columns, R"pbdoc(
+                        Returns the names of the tracked columns.)pbdoc")
+        .def("rows", &StreamingAnalyzer::rows, R"pbdoc(
+                        Returns the number of rows consumed so far.)pbdoc")
+        .def("count", &StreamingAnalyzer::count, R"pbdoc(
+                        Returns the number of non-null values seen in the column.)pbdoc")
+        .def("mean", &StreamingAnalyzer::mean, R"pbdoc(
+                        Returns the running mean of the column.)pbdoc")
+        .def("variance", &StreamingAnalyzer::variance, R"pbdoc(
+                        Returns the running variance of the column.)pbdoc")
+        .def("standardDeviation", &StreamingAnalyzer::standardDeviation, R"pbdoc(
+                        Returns the running standard deviation of the column.)pbdoc")
+        .def("min", &StreamingAnalyzer::min, R"pbdoc(
+                        Returns the minimum value seen in the column.)pbdoc")
+        .def("max", &StreamingAnalyzer::max, R"pbdoc(
+                        Returns the maximum value seen in the column.)pbdoc")
+        .def("approxQuantile", &StreamingAnalyzer::approxQuantile, R"pbdoc(
+                        Returns an approximate quantile of the column from its sketch.)pbdoc")
+        .def("approxMedian", &StreamingAnalyzer::approxMedian, R"pbdoc(
+                        Returns an approximate median of the column from its sketch.)pbdoc")
+        .def("approxDistinctCount", &StreamingAnalyzer::approxDistinctCount, R"pbdoc(
+                        Returns the approximate number of distinct values of the column.)pbdoc")
+        .def("correlationMatrix", &StreamingAnalyzer::correlationMatrix, R"pbdoc(
+                        Returns the correlation matrix of the tracked columns.)pbdoc")
+        .def("regression", &StreamingAnalyzer::regression,
+             py::arg("response"), py::arg("predictors"), py::arg("ridge") = 0.0, py::arg("intercept") = true, R"pbdoc(
+                        Fits response ~ predictors over the tracked columns from the accumulated
+                        co-moments.)pbdoc")
+        .def("reportStrongCorrelations",
+             [](StreamingAnalyzer& self, double threshold) {
+                 std::stringstream ss;
+                 self.reportStrongCorrelations(threshold, ss);
+                 return ss.str();
+             },
+             py::arg("threshold") = 0.7,
+             R"pbdoc(
+                        Reports tracked columns with absolute correlation above the given threshold.)pbdoc");
 }
@@ -3,8 +3,18 @@
 #include <memory>
 #include <unordered_map>
 #include <random>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <cmath>
+#include <limits>
 #include "../include/Statistics_Module/Dataset.hpp"
 #include "../include/Statistics_Module/Statistical_analyzer.hpp"
+#include "../include/Statistics_Module/Streaming_analyzer.hpp"
+#include "../include/Statistics_Module/Kernels.hpp"
 
 using namespace ScientificToolbox::Statistics;
 
@@ -45,6 +55,55 @@ public:
         assert(approx_equal(medianB, (20.0 + 30.0) / 2.0)); 
     }
 
+    void testQuantiles() {
+        assert(approx_equal(analyzer->percentile<double>("ColA", 50.0), 2.5));
+        assert(approx_equal(analyzer->interquartileRange<double>("ColB"), 15.0));
+
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::vector<double> values(10001);
+        for (auto& v : values) v = dist(gen);
+        std::vector<double> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        std::vector<double> probs = {0.99, 0.5, 0.9, 0.0, 1.0, 0.25};
+        auto q = quantilesInPlace(values, probs);
+        for (size_t i = 0; i < probs.size(); ++i) {
+            assert(q[i] == sorted[static_cast<size_t>(probs[i] * 10000)]);
+        }
+    }
+
+    void testQuantileSketch() {
+        std::mt19937 gen(5);
+        std::normal_distribution<double> dist(0.0, 1.0);
+        std::vector<std::unordered_map<std::string, OptionalDataValue>> rows;
+        QuantileSketch left, right;
+        for (int i = 0; i < 100000; ++i) {
+            double v = dist(gen);
+            rows.push_back({{"V", v}});
+            (i % 2 ? left : right).update(v);
+        }
+        auto ds = std::make_shared<Dataset>(rows);
+        StatisticalAnalyzer big(ds);
+
+        // Rank error of k = 200 is about 1%: compare ranks, not values
+        auto values = ds->getColumn<double>("V");
+        std::sort(values.begin(), values.end());
+        auto rankOf = [&values](double x) {
+            return static_cast<double>(std::upper_bound(values.begin(), values.end(), x) - values.begin()) / values.size();
+        };
+        assert(std::abs(rankOf(big.approxMedian("V")) - 0.5) < 0.02);
+        assert(std::abs(rankOf(big.approxQuantile("V", 0.99)) - 0.99) < 0.02);
+
+        left.merge(right);
+        assert(left.count() == 100000 && left.retained() < 2000);
+        assert(std::abs(rankOf(left.quantile(0.9)) - 0.9) < 0.02);
+
+        QuantileSketch copy = QuantileSketch::deserialize(left.serialize());
+        assert(copy.count() == left.count() && copy.quantile(0.25) == left.quantile(0.25));
+        assert(copy.min() == values.front() && copy.max() == values.back());
+    }
+
     void testVariance() {
         double varA = analyzer->variance<double>("ColA");
         double varB = analyzer->variance<double>("ColB");
@@ -59,6 +118,238 @@ public:
         assert(approx_equal(stdB, 11.1803, 1e-3));
     }
 
+    void testDescribe() {
+        auto summaries = analyzer->describe({"ColA", "ColB"});
+        assert(summaries.size() == 2);
+        const auto& a = summaries[0];
+        assert(a.column == "ColA" && a.count == 4);
+        assert(approx_equal(a.mean, 2.5) && approx_equal(a.variance, 1.25));
+        assert(approx_equal(a.standardDeviation, analyzer->standardDeviation<double>("ColA")));
+        assert(a.min == 1.0 && a.max == 4.0);
+        assert(a.quantiles.size() == 3);
+        assert(approx_equal(a.quantiles[0], 1.75) && approx_equal(a.quantiles[1], 2.5));
+        assert(approx_equal(summaries[1].quantiles[2], 32.5));
+    }
+
+    void testKernels() {
+        namespace K = ScientificToolbox::Statistics::Kernels;
+        // Large offset plus small noise: naive sums lose the low digits
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<double> noise(-1.0, 1.0);
+        std::vector<double> x(10007);
+        long double refSum = 0.0L;
+        for (auto& v : x) {
+            v = 1e8 + noise(gen);
+            refSum += v;
+        }
+        const double refMean = static_cast<double>(refSum / x.size());
+        long double refSsd = 0.0L;
+        for (double v : x) refSsd += (v - refMean) * (v - refMean);
+        const double refMin = *std::min_element(x.begin(), x.end());
+        const double refMax = *std::max_element(x.begin(), x.end());
+
+        const K::Isa original = K::activeIsa();
+        for (K::Isa isa : {K::Isa::Scalar, K::Isa::AVX2, K::Isa::AVX512}) {
+            if (!K::isSupported(isa)) continue;
+            K::setIsa(isa);
+            for (size_t n : {size_t{1}, size_t{3}, size_t{17}, x.size()}) {
+                long double s = 0.0L;
+                for (size_t i = 0; i < n; ++i) s += x[i];
+                const double exact = static_cast<double>(s);
+                assert(std::abs(K::compensatedSum(x.data(), n) - exact) <= 4e-16 * exact);
+                assert(std::abs(K::sum(x.data(), n) - exact) <= 1e-12 * exact);
+            }
+            assert(std::abs(K::sumSquaredDeviations(x.data(), x.size(), refMean) - refSsd) <= 1e-6 * refSsd);
+            double mn, mx;
+            K::minMax(x.data(), x.size(), mn, mx);
+            assert(mn == refMin && mx == refMax);
+            K::minMax(x.data() + 5, 3, mn, mx);
+            assert(mn == std::min({x[5], x[6], x[7]}) && mx == std::max({x[5], x[6], x[7]}));
+        }
+        K::setIsa(original);
+        assert(approx_equal(analyzer->mean<double>("ColA"), 2.5));
+    }
+
+    void testParallelAnalyzer() {
+        // Several chunks per column, plus one column with nulls that has to be copied
+        auto big = std::make_shared<Dataset>();
+        std::mt19937 gen(11);
+        std::normal_distribution<double> dist(50.0, 10.0);
+        long double refSum = 0.0L;
+        for (int i = 0; i < 200000; ++i) {
+            Dataset::Row row;
+            row["A"] = dist(gen);
+            row["B"] = static_cast<int>(i % 97);
+            row["C"] = (i % 5 == 0) ? OptionalDataValue() : OptionalDataValue(dist(gen));
+            refSum += std::get<double>(*row["A"]);
+            big->addRow(row);
+        }
+
+        StatisticalAnalyzer serial(big);
+        auto expected = serial.describe({"A", "B", "C"});
+        assert(std::abs(expected[0].mean - static_cast<double>(refSum / 200000)) < 1e-12);
+        assert(expected[2].count == 160000);
+        for (unsigned threads : {2u, 3u, 8u}) {
+            StatisticalAnalyzer parallel(big, threads);
+            assert(parallel.threads() == threads);
+            auto got = parallel.describe({"A", "B", "C"});
+            for (size_t c = 0; c < got.size(); ++c) {
+                assert(got[c].mean == expected[c].mean && got[c].variance == expected[c].variance);
+                assert(got[c].min == expected[c].min && got[c].max == expected[c].max);
+                assert(got[c].quantiles == expected[c].quantiles);
+            }
+            assert(parallel.mean<double>("A") == serial.mean<double>("A"));
+            assert(parallel.variance<double>("C") == serial.variance<double>("C"));
+            assert(parallel.mean<double>("A") == expected[0].mean);
+
+            bool threw = false;
+            try {
+                parallel.describe({"A", "Missing", "C"});
+            } catch (const std::runtime_error&) {
+                threw = true;
+            }
+            assert(threw);
+        }
+    }
+
+    void testFrequencyTable() {
+        FrequencyTable<int32_t> ints;
+        for (int32_t i = 0; i < 10000; ++i) ints.add(i % 1500, 1);
+        assert(ints.size() == 1500 && ints.total() == 10000);
+        assert(ints.count(7) == 7 && ints.count(1499) == 6 && ints.count(-1) == 0);
+        FrequencyTable<int32_t> more;
+        more.add(1499, 10);
+        ints.merge(more);
+        auto top = ints.topK(3);
+        assert(top.size() == 3 && top[0] == std::make_pair(1499, size_t{16}));
+        assert(top[1] == std::make_pair(0, size_t{7}) && top[2] == std::make_pair(1, size_t{7}));
+
+        FrequencyTable<double> doubles;
+        doubles.add(0.0);
+        doubles.add(-0.0);
+        doubles.add(std::nan(""));
+        doubles.add(std::nan(""));
+        assert(doubles.size() == 2 && doubles.count(0.0) == 2 && doubles.count(std::nan("")) == 2);
+
+        // Column counting paths against a naive count
+        auto ds = std::make_shared<Dataset>();
+        std::unordered_map<std::string, size_t> expectedStr;
+        std::unordered_map<double, size_t> expectedSmall, expectedWide, expectedReal;
+        for (int i = 0; i < 150000; ++i) {
+            Dataset::Row row;
+            std::string label = "c" + std::to_string((i * 7) % 23);
+            row["Label"] = label;
+            row["Small"] = (i % 13 == 0) ? OptionalDataValue() : OptionalDataValue(i % 40 - 20);
+            row["Wide"] = (i % 1000) * 1000003;
+            row["Real"] = (i % 50) * 0.5;
+            ds->addRow(row);
+            ++expectedStr[label];
+            if (i % 13 != 0) ++expectedSmall[i % 40 - 20];
+            ++expectedWide[(i % 1000) * 1000003.0];
+            ++expectedReal[(i % 50) * 0.5];
+        }
+        for (unsigned threads : {1u, 4u}) {
+            StatisticalAnalyzer fa(ds, threads);
+            assert(fa.frequencyCount<std::string>("Label") == expectedStr);
+            assert(fa.frequencyCount<double>("Small") == expectedSmall);
+            assert(fa.frequencyCount<double>("Wide") == expectedWide);
+            assert(fa.frequencyCount<double>("Real") == expectedReal);
+            auto topLabels = fa.mostFrequent<std::string>("Label", 2);
+            assert(topLabels.size() == 2 && topLabels[0].second >= topLabels[1].second);
+            assert(topLabels[0].second == expectedStr[topLabels[0].first]);
+        }
+        bool threw = false;
+        try {
+            analyzer->frequencyCount<std::string>("ColA");
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    void testGroupBy() {
+        auto ds = std::make_shared<Dataset>();
+        std::map<std::pair<std::string, int>, std::vector<double>> expected;
+        std::vector<std::pair<std::string, int>> firstSeen;
+        const char* diets[] = {"vegan", "omnivore", "keto"};
+        std::mt19937 gen(21);
+        std::uniform_real_distribution<double> kcal(100.0, 900.0);
+        for (int i = 0; i < 90000; ++i) {
+            std::string diet = diets[(i * 5 + i / 7) % 3];
+            int level = i % 4;
+            double value = kcal(gen);
+            bool missing = i % 10 == 3;
+            Dataset::Row row;
+            row["Diet"] = diet;
+            row["Level"] = level;
+            row["Calories"] = missing ? OptionalDataValue() : OptionalDataValue(value);
+            ds->addRow(row);
+            auto key = std::make_pair(diet, level);
+            if (!expected.count(key)) firstSeen.push_back(key);
+            auto& values = expected[key];
+            if (!missing) values.push_back(value);
+        }
+
+        Dataset single;
+        for (unsigned threads : {1u, 3u}) {
+            StatisticalAnalyzer ga(ds, threads);
+            GroupBy groups = ga.groupBy({"Diet", "Level"});
+            assert(groups.groups() == expected.size());
+            Dataset result = groups.agg({{"Calories", {AggregateKind::Count, AggregateKind::Mean, AggregateKind::Variance,
+                                                       AggregateKind::Max, Aggregate::quantile(0.5)}}});
+            assert(result.getColumnNames() == std::vector<std::string>({"Diet", "Level", "Calories_count",
+                                                                       "Calories_mean", "Calories_var",
+                                                                       "Calories_max", "Calories_p50"}));
+            assert(result.size() == firstSeen.size());
+            for (size_t g = 0; g < firstSeen.size(); ++g) {
+                auto row = result.row(g);
+                assert(std::get<std::string>(*row["Diet"]) == firstSeen[g].first);
+                assert(std::get<int>(*row["Level"]) == firstSeen[g].second);
+                std::vector<double> values = expected[firstSeen[g]];
+                double m = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+                double v = 0.0;
+                for (double x : values) v += (x - m) * (x - m);
+                assert(std::get<int>(*row["Calories_count"]) == static_cast<int>(values.size()));
+                assert(approx_equal(std::get<double>(*row["Calories_mean"]), m, 1e-9));
+                assert(approx_equal(std::get<double>(*row["Calories_var"]), v / values.size(), 1e-6));
+                assert(std::get<double>(*row["Calories_max"]) == *std::max_element(values.begin(), values.end()));
+                assert(approx_equal(std::get<double>(*row["Calories_p50"]), quantileInPlace(values, 0.5), 1e-12));
+            }
+            if (threads == 1) {
+                single = ga.groupBy({"Diet"}).size();
+            } else {
+                Dataset sizes = ga.groupBy({"Diet"}).size();
+                assert(sizes.getColumn<int>("count") == single.getColumn<int>("count"));
+                assert(sizes.getColumn<std::string>("Diet") == single.getColumn<std::string>("Diet"));
+            }
+        }
+        assert(single.getColumn<std::string>("Diet") == std::vector<std::string>({"vegan", "keto", "omnivore"}));
+
+        // Mixed keys group by exact value: near-equal doubles stay apart, -0.0 joins 0.0
+        auto mixed = std::make_shared<Dataset>();
+        std::vector<DataValue> mixedKeys = {1.0000001, 1.0000002, std::string("a"), 1.0000001, 7,
+                                            std::string("a"), -0.0, 0.0, 1.0000002};
+        for (size_t i = 0; i < mixedKeys.size(); ++i) {
+            mixed->addRow({{"Key", mixedKeys[i]}, {"Value", static_cast<double>(i)}});
+        }
+        assert(mixed->column("Key").type() == ColumnType::Mixed);
+        GroupBy mixedGroups = StatisticalAnalyzer(mixed).groupBy({"Key"});
+        assert(mixedGroups.groups() == 5);
+        Dataset sums = mixedGroups.agg({{"Value", {AggregateKind::Sum}}});
+        assert(sums.getColumn<double>("Value_sum") == std::vector<double>({3.0, 9.0, 7.0, 4.0, 13.0}));
+        assert(std::get<double>(*sums.column("Key").at(1)) == 1.0000002);
+
+        assert(Aggregate::parse("p99.9").suffix() == "p99.9");
+        assert(Aggregate::parse("median").probability == 0.5);
+        bool threw = false;
+        try {
+            Aggregate::parse("mode");
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
     void testCorrelation() {
         auto cm = analyzer->correlationMatrix({"ColA", "ColB"});
         assert(cm.rows() == 2 && cm.cols() == 2);
@@ -66,6 +357,1137 @@ public:
         assert(approx_equal(cm(1, 0), 1.0, 1e-1));
     }
 
+    void testBlockedCorrelation() {
+        // More rows than one stripe, an Int column and a large offset
+        const int rows = 70000;
+        auto wide = std::make_shared<Dataset>();
+        Eigen::MatrixXd dense(rows, 4);
+        std::mt19937 gen(5);
+        std::normal_distribution<double> dist(0.0, 1.0);
+        for (int i = 0; i < rows; ++i) {
+            double x = dist(gen);
+            dense.row(i) << 1e6 + x, 3.0 * x + dist(gen), -x + 0.1 * dist(gen), static_cast<double>(i % 13);
+            wide->addRow({{"W", dense(i, 0)}, {"X", dense(i, 1)}, {"Y", dense(i, 2)}, {"Z", static_cast<int>(i % 13)}});
+        }
+        Eigen::MatrixXd centered = dense.rowwise() - dense.colwise().mean();
+        Eigen::MatrixXd cov = centered.transpose() * centered;
+        Eigen::VectorXd sd = cov.diagonal().array().sqrt();
+        Eigen::MatrixXd expected = cov.array() / (sd * sd.transpose()).array();
+
+        std::vector<std::string> cols = {"W", "X", "Y", "Z"};
+        StatisticalAnalyzer serial(wide);
+        Eigen::MatrixXd full = serial.correlationMatrix(cols);
+        assert(full.isApprox(expected, 1e-9));
+        assert(full.isApprox(full.transpose()));
+        for (unsigned threads : {2u, 5u}) {
+            StatisticalAnalyzer parallel(wide, threads);
+            assert(parallel.correlationMatrix(cols) == full);
+        }
+        Eigen::MatrixXd upper = serial.correlationMatrix(cols, true);
+        assert(upper.triangularView<Eigen::Upper>().toDenseMatrix() == full.triangularView<Eigen::Upper>().toDenseMatrix());
+        assert(upper(3, 0) == 0.0 && upper(2, 1) == 0.0);
+
+        bool threw = false;
+        try {
+            analyzer->correlationMatrix({"ColA", "Missing"});
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+
+    void testPairwiseCorrelation() {
+        // Sparse nulls in different rows of each column
+        auto sparse = std::make_shared<Dataset>();
+        std::vector<std::array<double, 3>> values;
+        std::mt19937 gen(9);
+        std::normal_distribution<double> dist(0.0, 1.0);
+        for (int i = 0; i < 3000; ++i) {
+            double x = dist(gen);
+            values.push_back({100.0 + x, 2.0 * x + dist(gen), static_cast<double>(i % 7)});
+            Dataset::Row row;
+            row["X"] = (i % 11 == 0) ? OptionalDataValue() : OptionalDataValue(values.back()[0]);
+            row["Y"] = (i % 17 == 3) ? OptionalDataValue() : OptionalDataValue(values.back()[1]);
+            row["Z"] = (i % 5 == 1) ? OptionalDataValue() : OptionalDataValue(static_cast<int>(i % 7));
+            sparse->addRow(row);
+        }
+        auto present = [](int i, int c) {
+            return c == 0 ? i % 11 != 0 : c == 1 ? i % 17 != 3 : i % 5 != 1;
+        };
+        // Reference: filtered copy per pair
+        auto reference = [&](int a, int b) {
+            std::vector<double> xa, xb;
+            for (int i = 0; i < 3000; ++i) {
+                if (present(i, a) && present(i, b)) {
+                    xa.push_back(values[i][a]);
+                    xb.push_back(values[i][b]);
+                }
+            }
+            double ma = std::accumulate(xa.begin(), xa.end(), 0.0) / xa.size();
+            double mb = std::accumulate(xb.begin(), xb.end(), 0.0) / xb.size();
+            double sab = 0.0, saa = 0.0, sbb = 0.0;
+            for (size_t i = 0; i < xa.size(); ++i) {
+                sab += (xa[i] - ma) * (xb[i] - mb);
+                saa += (xa[i] - ma) * (xa[i] - ma);
+                sbb += (xb[i] - mb) * (xb[i] - mb);
+            }
+            return sab / std::sqrt(saa * sbb);
+        };
+
+        StatisticalAnalyzer sa(sparse);
+        Eigen::MatrixXd r = sa.correlationMatrix({"X", "Y", "Z"});
+        for (int a = 0; a < 3; ++a) {
+            assert(approx_equal(r(a, a), 1.0, 1e-12));
+            for (int b = 0; b < 3; ++b) {
+                if (a != b) assert(approx_equal(r(a, b), reference(a, b), 1e-10));
+            }
+        }
+        StatisticalAnalyzer threaded(sparse, 4);
+        assert(threaded.correlationMatrix({"X", "Y", "Z"}) == r);
+
+        Eigen::MatrixXd propagated = sa.correlationMatrix({"X", "Y"}, false, MissingPolicy::Propagate);
+        assert(std::isnan(propagated(0, 1)));
+    }
+
+    void testRankCorrelation() {
+        // Brute-force tau-b and Spearman on data with many ties
+        std::mt19937 gen(3);
+        std::uniform_int_distribution<int> small(0, 9);
+        std::vector<double> x(500), y(500), z(500);
+        for (size_t i = 0; i < x.size(); ++i) {
+            x[i] = small(gen);
+            y[i] = x[i] + small(gen);
+            z[i] = std::sqrt(static_cast<double>(i)) + 0.001 * small(gen);
+        }
+        auto bruteTau = [](const std::vector<double>& a, const std::vector<double>& b) {
+            double concordant = 0, discordant = 0, tiesA = 0, tiesB = 0;
+            for (size_t i = 0; i < a.size(); ++i) {
+                for (size_t j = i + 1; j < a.size(); ++j) {
+                    double s = (a[i] - a[j]) * (b[i] - b[j]);
+                    if (a[i] == a[j]) tiesA += 1;
+                    if (b[i] == b[j]) tiesB += 1;
+                    if (s > 0) concordant += 1;
+                    if (s < 0) discordant += 1;
+                }
+            }
+            double n0 = a.size() * (a.size() - 1) / 2.0;
+            return (concordant - discordant) / std::sqrt((n0 - tiesA) * (n0 - tiesB));
+        };
+        assert(approx_equal(kendallTau(x, y), bruteTau(x, y), 1e-12));
+        assert(approx_equal(kendallTau(z, y), bruteTau(z, y), 1e-12));
+        assert(approx_equal(kendallTau(x, x), 1.0, 1e-12));
+
+        // Spearman equals Pearson of average ranks; monotone transforms do not change it
+        std::vector<double> cubes(z.size());
+        std::transform(z.begin(), z.end(), cubes.begin(), [](double v) { return v * v * v; });
+        assert(approx_equal(spearmanCorrelation(z, cubes), 1.0, 1e-12));
+        assert(approx_equal(spearmanCorrelation(std::vector<double>{1, 2, 2, 3}, std::vector<double>{1, 3, 2, 4}),
+                            0.948683298, 1e-8));
+
+        // Matrices over a dataset with nulls: listwise deletion
+        auto ds = std::make_shared<Dataset>();
+        std::vector<double> fx, fy, fz;
+        for (size_t i = 0; i < x.size(); ++i) {
+            Dataset::Row row;
+            bool drop = i % 9 == 4;
+            row["X"] = static_cast<int>(x[i]);
+            row["Y"] = drop ? OptionalDataValue() : OptionalDataValue(y[i]);
+            row["Z"] = z[i];
+            ds->addRow(row);
+            if (!drop) {
+                fx.push_back(x[i]);
+                fy.push_back(y[i]);
+                fz.push_back(z[i]);
+            }
+        }
+        StatisticalAnalyzer ra(ds);
+        Eigen::MatrixXd tau = ra.kendallCorrelationMatrix({"X", "Y", "Z"});
+        Eigen::MatrixXd rho = ra.spearmanCorrelationMatrix({"X", "Y", "Z"});
+        assert(approx_equal(tau(0, 1), bruteTau(fx, fy), 1e-12) && tau(1, 0) == tau(0, 1));
+        assert(approx_equal(tau(1, 2), bruteTau(fy, fz), 1e-12));
+        assert(approx_equal(rho(0, 2), spearmanCorrelation(fx, fz), 1e-12));
+        assert(approx_equal(rho(2, 2), 1.0, 1e-12));
+        StatisticalAnalyzer threaded(ds, 3);
+        assert(threaded.kendallCorrelationMatrix({"X", "Y", "Z"}) == tau);
+        assert(threaded.spearmanCorrelationMatrix({"X", "Y", "Z"}, true)(2, 0) == 0.0);
+    }
+
+    void testColumnarStorage() {
+        Dataset ds;
+        ds.addRow({{"Id", 1}, {"Score", 2.5}, {"Group", std::string("a")}});
+        ds.addRow({{"Id", 2}, {"Score", std::nullopt}, {"Group", std::string("b")}});
+        ds.addRow({{"Id", 3}, {"Score", 4.5}, {"Group", std::string("a")}});
+
+        auto ids = ds.getColumnView<int32_t>("Id");
+        assert(ids.size() == 3 && ids[2] == 3);
+        assert(ids.data() == ds.getColumnView<int32_t>("Id").data());
+
+        auto scores = ds.getColumnView<double>("Score");
+        assert(scores.nullCount() == 1 && !scores.isValid(1));
+        assert(ds.getColumn<double>("Score").size() == 2);
+
+        auto groups = ds.getColumnView<uint32_t>("Group");
+        assert(ds.column("Group").dictionary().size() == 2);
+        assert(groups[0] == groups[2]);
+
+        assert(ds.isNumericColumn("Id") && ds.isNumericColumn("Score"));
+        assert(!ds.isNumericColumn("Group"));
+
+        size_t rows = 0;
+        for (const auto& row : ds) {
+            assert(row.at("Id").has_value());
+            ++rows;
+        }
+        assert(rows == ds.size());
+        assert(!ds.row(1).at("Score").has_value());
+    }
+
+    void testStringPool() {
+        StringPool pool;
+        assert(pool.find("x") == StringPool::npos);
+        std::vector<std::string> words;
+        for (int i = 0; i < 1000; ++i) words.push_back("w" + std::to_string(i));
+        for (size_t i = 0; i < words.size(); ++i) {
+            assert(pool.intern(words[i]) == i);
+        }
+        assert(pool.intern("") == words.size());
+        assert(pool.size() == words.size() + 1);
+        for (size_t i = 0; i < words.size(); ++i) {
+            assert(pool.intern(words[i]) == i && pool.find(words[i]) == i);
+            assert(pool[static_cast<uint32_t>(i)] == words[i]);
+        }
+        assert(pool[static_cast<uint32_t>(words.size())].empty());
+        pool.clear();
+        assert(pool.empty() && pool.find("w1") == StringPool::npos);
+
+        Dataset ds;
+        const char* cities[] = {"Milano", "Torino", "Roma"};
+        const size_t n = 100000;
+        Column city;
+        city.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 50 == 7) city.appendNull();
+            else city.appendString(cities[i % 3]);
+        }
+        ds.addColumn("City", std::move(city));
+        const Column& column = ds.column("City");
+        assert(column.dictionary().size() == 3);
+
+        uint32_t rome = column.codeOf("Roma");
+        assert(rome != StringPool::npos && column.codeOf("Napoli") == StringPool::npos);
+        auto codes = column.view<uint32_t>();
+        size_t romeRows = 0;
+        for (size_t i = 0; i < codes.size(); ++i) {
+            bool equal = codes.isValid(i) && codes[i] == rome;
+            assert(equal == (codes.isValid(i) && std::get<std::string>(*column.at(i)) == "Roma"));
+            romeRows += equal;
+        }
+        auto counts = StatisticalAnalyzer(std::make_shared<Dataset>(ds)).frequencyTable<std::string>("City");
+        assert(counts.count("Roma") == romeRows);
+
+        // Row-wise storage holds an OptionalDataValue (and often a heap string) per row
+        assert(ds.memoryUsage() * 10 < n * sizeof(OptionalDataValue));
+
+        Column other;
+        other.appendString("Roma");
+        other.appendString("Napoli");
+        Column merged = column;
+        merged.append(other);
+        assert(merged.dictionary().size() == 4);
+        assert(merged.view<uint32_t>()[n] == rome && merged.codeOf("Napoli") == 3);
+    }
+
+
+    void testMappedImport() {
+        auto path = std::filesystem::temp_directory_path() / "stats_mapped_import.csv";
+        {
+            std::ofstream out(path);
+            out << "Id,Score,Note\n"
+                << "1,2.5,plain\n"
+                << "2,,\"comma, inside\"\n"
+                << "3,+4,\"two\nlines\"\n"
+                << "4,1e1\n";
+        }
+        Dataset ds = Dataset::fromCSV(path.string());
+        std::filesystem::remove(path);
+
+        assert(ds.size() == 4);
+        assert(ds.getColumnNames() == std::vector<std::string>({"Id", "Score", "Note"}));
+        assert(ds.getColumnView<int32_t>("Id")[3] == 4);
+        auto score = ds.getColumnView<double>("Score");
+        assert(!score.isValid(1) && approx_equal(score[2], 4.0) && approx_equal(score[3], 10.0));
+        auto notes = ds.getColumn<std::string>("Note");
+        assert(notes.size() == 3 && notes[1] == "comma, inside" && notes[2] == "two\nlines");
+
+        // Only a '+' before a digit or '.' is a sign
+        {
+            std::ofstream out(path);
+            out << "Int,Fraction,Minus,Plus\n+5,+.5,+-5,++5\n-5,+2.5,+-2.5,++1\n+0,-.5,+-.5,+\n";
+        }
+        Dataset signs = Dataset::fromCSV(path.string());
+        std::filesystem::remove(path);
+        assert(signs.getColumn<int>("Int") == std::vector<int>({5, -5, 0}));
+        assert(signs.getColumn<double>("Fraction") == std::vector<double>({0.5, 2.5, -0.5}));
+        assert(signs.getColumn<std::string>("Minus") == std::vector<std::string>({"+-5", "+-2.5", "+-.5"}));
+        assert(signs.getColumn<std::string>("Plus") == std::vector<std::string>({"++5", "++1", "+"}));
+    }
+
+
+    void testSnapshot() {
+        auto path = std::filesystem::temp_directory_path() / "stats_snapshot.bin";
+        Dataset ds;
+        for (int i = 0; i < 1000; ++i) {
+            Dataset::Row row;
+            row["Id"] = i;
+            row["Score"] = i % 9 == 4 ? OptionalDataValue() : OptionalDataValue(0.25 * i - 40.0);
+            row["Group"] = std::string(i % 3 == 0 ? "alpha" : (i % 3 == 1 ? "beta" : ""));
+            row["Mixed"] = i % 2 == 0 ? OptionalDataValue(i) : OptionalDataValue(std::string("m") + std::to_string(i % 5));
+            row["Nothing"] = std::nullopt;
+            ds.addRow(row);
+        }
+        ds.save(path.string());
+        assert(Dataset::isSnapshot(path.string()));
+
+        std::map<std::string, SnapshotColumn> schema;
+        for (const auto& column : Dataset::snapshotSchema(path.string())) {
+            schema[column.name] = column;
+        }
+        assert(schema.size() == 5 && schema["Id"].type == ColumnType::Int);
+        assert(schema["Id"].min == 0.0 && schema["Id"].max == 999.0 && schema["Id"].count == 1000);
+        assert(schema["Score"].nullCount == 111 && schema["Score"].min == -40.0);
+        assert(schema["Score"].max == 0.25 * 999 - 40.0);
+        assert(std::isnan(schema["Group"].min) && schema["Nothing"].type == ColumnType::Empty);
+
+        {
+            Dataset loaded = Dataset::load(path.string());
+            assert(loaded.size() == ds.size() && loaded.getColumnNames() == ds.getColumnNames());
+            for (const auto& name : ds.getColumnNames()) {
+                assert(loaded.column(name).type() == ds.column(name).type());
+                for (size_t i = 0; i < ds.size(); ++i) {
+                    assert(loaded.column(name).at(i) == ds.column(name).at(i));
+                }
+            }
+            // Numeric buffers are borrowed from the mapping, not copied
+            assert(loaded.column("Score").memoryUsage() < 1000 * sizeof(double) / 10);
+            assert(loaded.column("Group").codeOf("beta") == ds.column("Group").codeOf("beta"));
+
+            Dataset::Row row;
+            row["Id"] = 1000;
+            row["Score"] = 1.5;
+            row["Group"] = std::string("gamma");
+            row["Mixed"] = std::nullopt;
+            row["Nothing"] = std::nullopt;
+            loaded.addRow(row);
+            assert(loaded.size() == 1001 && loaded.getColumnView<double>("Score")[1000] == 1.5);
+            assert(!loaded.column("Mixed").isValid(1000));
+            auto stats = StatisticalAnalyzer(std::make_shared<Dataset>(loaded)).frequencyTable<std::string>("Group");
+            assert(stats.count("gamma") == 1 && stats.count("alpha") == 334);
+        }
+
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::in);
+            out.seekp(8);
+            out.put(9);
+        }
+        bool threw = false;
+        try {
+            Dataset::fromSnapshot(path.string());
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        std::filesystem::remove(path);
+        assert(!Dataset::isSnapshot(path.string()));
+    }
+
+
+    void testParallelImport() {
+        auto path = std::filesystem::temp_directory_path() / "stats_parallel_import.csv";
+        {
+            std::ofstream out(path);
+            out << "Id,Value,Text\n";
+            for (int i = 0; i < 500; ++i) {
+                out << i << "," << (i % 7 == 0 ? std::string() : std::to_string(i * 0.5))
+                    << ",\"row " << i << (i % 3 == 0 ? ",\nwrapped \"\"quoted\"\"" : "") << "\"\n";
+            }
+        }
+        Dataset serial = Dataset::fromCSV(path.string());
+        for (unsigned threads : {2u, 7u, 64u}) {
+            Dataset parallel = Dataset::fromCSV(path.string(), threads);
+            assert(parallel.size() == serial.size());
+            assert(parallel.getColumn<int>("Id") == serial.getColumn<int>("Id"));
+            assert(parallel.getColumn<double>("Value") == serial.getColumn<double>("Value"));
+            assert(parallel.getColumn<std::string>("Text") == serial.getColumn<std::string>("Text"));
+            assert(parallel.getColumnView<double>("Value").nullCount() == 72);
+        }
+        std::filesystem::remove(path);
+    }
+
+
+    void testSchemaInference() {
+        auto path = std::filesystem::temp_directory_path() / "stats_schema_inference.csv";
+        {
+            std::ofstream out(path);
+            out << "Id,Price,Zip,Code,Late\n";
+            for (int i = 0; i < 300; ++i) {
+                out << i << "," << (i % 2 == 0 ? std::to_string(i) : std::to_string(i) + ".5") << ","
+                    << (i == 3 ? "N/A" : "0" + std::to_string(1000 + i)) << "," << i % 10 << ","
+                    << (i < 200 ? std::to_string(i) : std::string("x") + std::to_string(i)) << "\n";
+            }
+        }
+
+        using ScientificToolbox::FieldType;
+        ScientificToolbox::Importer importer;
+        importer.importMapped(path.string());
+        assert(importer.getData().size() == 300);
+        assert(importer.getColumnTypes() == std::vector<FieldType>({FieldType::Int, FieldType::Double,
+                                                                    FieldType::String, FieldType::Int,
+                                                                    FieldType::String}));
+
+        ScientificToolbox::ImportOptions options;
+        options.sampleRows = 100;
+        options.types["Code"] = FieldType::String;
+        for (unsigned threads : {1u, 3u}) {
+            Dataset ds = Dataset::fromCSV(path.string(), threads, options);
+            // Integral prices are parsed as doubles from the first row on
+            assert(ds.column("Price").type() == ColumnType::Double);
+            assert(ds.getColumnView<double>("Price")[1] == 1.5);
+            // Zip codes keep their leading zero, numeric-looking cells included
+            assert(ds.column("Zip").type() == ColumnType::String);
+            assert(std::get<std::string>(*ds.column("Zip").at(0)) == "01000");
+            assert(ds.column("Code").type() == ColumnType::String && ds.column("Code").dictionary().size() == 10);
+            // Cells past the sample that do not fit fall back to per-cell classification
+            assert(ds.column("Late").type() == ColumnType::Mixed);
+            assert(std::get<int>(*ds.column("Late").at(199)) == 199);
+            assert(std::get<std::string>(*ds.column("Late").at(200)) == "x200");
+        }
+
+        options.types["Missing"] = FieldType::Int;
+        bool threw = false;
+        try {
+            Dataset::fromCSV(path.string(), 1, options);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        std::filesystem::remove(path);
+    }
+
+
+    void testProjectedImport() {
+        auto path = std::filesystem::temp_directory_path() / "stats_projected_import.csv";
+        {
+            std::ofstream out(path);
+            out << "Meal,Calories,Notes,Protein,Diet\n";
+            for (int i = 0; i < 400; ++i) {
+                out << "meal " << i << "," << 100 + i << ",\"" << std::string(200, 'a' + i % 26) << i
+                    << ", with \"\"quotes\"\"\"," << (i % 5 == 0 ? std::string() : std::to_string(i * 0.5))
+                    << "," << (i % 2 ? "vegan" : "keto") << "\n";
+            }
+        }
+        Dataset full = Dataset::fromCSV(path.string());
+
+        ScientificToolbox::ImportOptions options;
+        options.columns = {"Protein", "Calories"};
+        for (unsigned threads : {1u, 4u}) {
+            Dataset ds = Dataset::fromCSV(path.string(), threads, options);
+            assert(ds.getColumnNames() == options.columns && ds.size() == full.size());
+            assert(ds.getColumn<double>("Protein") == full.getColumn<double>("Protein"));
+            assert(ds.getColumn<int>("Calories") == full.getColumn<int>("Calories"));
+            assert(ds.memoryUsage() * 10 < full.memoryUsage());
+        }
+
+        options.columns = {"Diet", "Calories", "Notes"};
+        options.predicate = [](const ScientificToolbox::RecordView& record) {
+            return record.text(0) == "vegan" && record.number(1).value_or(0.0) >= 300.0;
+        };
+        Dataset filtered = Dataset::fromCSV(path.string(), 3, options);
+        assert(filtered.size() == 100);
+        assert(std::get<int>(*filtered.column("Calories").at(0)) == 301);
+        assert(filtered.column("Diet").dictionary().size() == 1);
+        assert(std::get<std::string>(*filtered.column("Notes").at(0)).find(", with \"quotes\"") == 203);
+
+        options.columns = {"Calories", "Fat"};
+        bool threw = false;
+        try {
+            Dataset::fromCSV(path.string(), 1, options);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        std::filesystem::remove(path);
+    }
+
+
+    void testFilter() {
+        // Kernel bitmaps against a brute force, on sizes that leave partial words
+        namespace K = Kernels;
+        std::vector<double> x(1000);
+        std::vector<int32_t> k(1000);
+        for (size_t i = 0; i < x.size(); ++i) {
+            x[i] = i % 17 == 0 ? std::numeric_limits<double>::quiet_NaN() : std::sin(0.37 * i) * 10.0;
+            k[i] = static_cast<int32_t>(i * 7919 % 201) - 100;
+        }
+        const K::Isa original = K::activeIsa();
+        for (K::Isa isa : {K::Isa::Scalar, K::Isa::AVX2, K::Isa::AVX512}) {
+            if (!K::isSupported(isa)) continue;
+            K::setIsa(isa);
+            for (size_t n : {size_t{1}, size_t{63}, size_t{64}, size_t{77}, x.size()}) {
+                std::vector<uint64_t> bits((n + 63) / 64, ~uint64_t{0}), ints = bits;
+                K::selectBetween(x.data(), n, -2.5, 4.0, bits.data());
+                K::selectBetween(k.data(), n, -30, 45, ints.data());
+                for (size_t i = 0; i < bits.size() * 64; ++i) {
+                    bool bit = (bits[i / 64] >> (i % 64)) & 1u, intBit = (ints[i / 64] >> (i % 64)) & 1u;
+                    assert(bit == (i < n && x[i] >= -2.5 && x[i] <= 4.0));
+                    assert(intBit == (i < n && k[i] >= -30 && k[i] <= 45));
+                }
+            }
+        }
+        K::setIsa(original);
+
+        // Several chunks of rows, with nulls in every column
+        auto ds = std::make_shared<Dataset>();
+        const char* diets[] = {"vegan", "omnivore", "keto"};
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<double> score(0.0, 100.0);
+        std::vector<OptionalDataValue> scores, ages, dietValues;
+        for (int i = 0; i < 150000; ++i) {
+            Dataset::Row row;
+            row["Score"] = i % 11 == 4 ? OptionalDataValue() : OptionalDataValue(score(gen));
+            row["Age"] = i % 13 == 6 ? OptionalDataValue() : OptionalDataValue(18 + i % 60);
+            row["Diet"] = i % 17 == 9 ? OptionalDataValue() : OptionalDataValue(std::string(diets[i % 3]));
+            scores.push_back(row["Score"]);
+            ages.push_back(row["Age"]);
+            dietValues.push_back(row["Diet"]);
+            ds->addRow(row);
+        }
+        auto number = [](const OptionalDataValue& v) {
+            return std::holds_alternative<int>(*v) ? std::get<int>(*v) : std::get<double>(*v);
+        };
+
+        Filter filter = (Filter::between("Score", 25.0, 75.0) & Filter::greater("Age", 40)) |
+                        Filter::equal("Diet", "keto");
+        std::vector<bool> expected(ds->size());
+        for (size_t i = 0; i < ds->size(); ++i) {
+            bool inRange = scores[i] && number(scores[i]) >= 25.0 && number(scores[i]) <= 75.0;
+            bool older = ages[i] && number(ages[i]) > 40;
+            bool keto = dietValues[i] && std::get<std::string>(*dietValues[i]) == "keto";
+            expected[i] = (inRange && older) || keto;
+        }
+        for (unsigned threads : {1u, 3u}) {
+            Selection rows = filter.evaluate(*ds, threads);
+            assert(rows.rows() == ds->size());
+            for (size_t i = 0; i < ds->size(); ++i) assert(rows.contains(i) == expected[i]);
+            assert(rows.count() == static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+        }
+
+        // Comparisons never select nulls; ~ is a plain complement
+        Selection notVegan = Filter::notEqual("Diet", "vegan").evaluate(*ds);
+        Selection complement = (~Filter::equal("Diet", "vegan")).evaluate(*ds);
+        Selection nulls = Filter::isNull("Diet").evaluate(*ds);
+        assert(complement.count() == notVegan.count() + nulls.count());
+        assert((notVegan & nulls).count() == 0);
+        assert(Filter::isIn("Age", {20, 21, 22}).evaluate(*ds).count() ==
+               Filter::between("Age", 19.5, 22.0).evaluate(*ds).count());
+        assert(Filter::less("Age", 18).evaluate(*ds).count() == 0);
+        assert(Filter::equal("Diet", "paleo").evaluate(*ds).count() == 0);
+        bool threw = false;
+        try {
+            Filter::less("Diet", 3.0).evaluate(*ds);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        // Analysis of the matching rows, over buffers shared with the full dataset
+        StatisticalAnalyzer full(ds, 2);
+        StatisticalAnalyzer subset = full.where(Filter::greaterEqual("Age", 50) & Filter::notNull("Diet"));
+        std::map<std::string, std::vector<double>> byDiet;
+        std::vector<std::string> order;
+        double sum = 0.0;
+        size_t count = 0;
+        for (size_t i = 0; i < ds->size(); ++i) {
+            if (!ages[i] || number(ages[i]) < 50 || !dietValues[i]) continue;
+            const std::string& diet = std::get<std::string>(*dietValues[i]);
+            if (!byDiet.count(diet)) order.push_back(diet);
+            auto& values = byDiet[diet];
+            if (scores[i]) {
+                sum += number(scores[i]);
+                values.push_back(number(scores[i]));
+                ++count;
+            }
+        }
+        assert(approx_equal(subset.mean<double>("Score"), sum / count, 1e-9));
+        Dataset perDiet = subset.groupBy({"Diet"}).agg({{"Score", {AggregateKind::Count, AggregateKind::Mean}}});
+        assert(perDiet.getColumn<std::string>("Diet") == order);
+        for (size_t g = 0; g < order.size(); ++g) {
+            const auto& values = byDiet[order[g]];
+            auto row = perDiet.row(g);
+            assert(std::get<int>(*row["Score_count"]) == static_cast<int>(values.size()));
+            assert(approx_equal(std::get<double>(*row["Score_mean"]),
+                                std::accumulate(values.begin(), values.end(), 0.0) / values.size(), 1e-9));
+        }
+
+        // Only the validity bitmaps (one bit per row and column) are allocated
+        Dataset masked = Dataset::where(ds, Filter::less("Score", 10.0).evaluate(*ds));
+        assert(masked.size() == ds->size() && masked.memoryUsage() < ds->size() / 2);
+        for (double v : masked.getColumn<double>("Score")) assert(v < 10.0);
+
+        // Appending to the source copies the shared buffers instead of moving them
+        const size_t selected = masked.getColumn<double>("Score").size();
+        for (int i = 0; i < 1000; ++i) {
+            ds->addRow({{"Score", 5.0}, {"Age", 30}, {"Diet", std::string("keto")}});
+        }
+        assert(masked.getColumn<double>("Score").size() == selected);
+        assert(ds->getColumnView<double>("Score")[ds->size() - 1] == 5.0);
+    }
+
+    void testStatsCache() {
+        std::mt19937 gen(17);
+        std::normal_distribution<double> dist(5.0, 3.0);
+        size_t produced = 0;
+        auto batch = [&](size_t rows) {
+            Column a, b, c;
+            for (size_t i = 0; i < rows; ++i, ++produced) {
+                double x = dist(gen);
+                a.appendDouble(x);
+                b.appendInt(static_cast<int32_t>(produced % 97));
+                if (produced % 9 == 4) {
+                    c.appendNull();
+                } else {
+                    c.appendDouble(0.5 * x + dist(gen));
+                }
+            }
+            Dataset out;
+            out.addColumn("A", std::move(a));
+            out.addColumn("B", std::move(b));
+            out.addColumn("C", std::move(c));
+            return out;
+        };
+
+        auto ds = std::make_shared<Dataset>(batch(70000));
+        StatisticalAnalyzer cached(ds, 3);
+        const std::vector<std::string> columns = {"A", "B", "C"};
+        for (int step = 0; step < 24; ++step) {
+            StatisticalAnalyzer fresh(ds, 2);
+            for (const auto& name : columns) {
+                assert(cached.mean<double>(name) == fresh.mean<double>(name));
+                assert(cached.variance<double>(name) == fresh.variance<double>(name));
+            }
+            Eigen::ArrayXXd propagate = cached.correlationMatrix(columns, false, MissingPolicy::Propagate).array();
+            Eigen::ArrayXXd expected = fresh.correlationMatrix(columns, false, MissingPolicy::Propagate).array();
+            assert((propagate == expected || (propagate.isNaN() && expected.isNaN())).all());
+            assert(!std::isnan(propagate(0, 1)));
+            Eigen::MatrixXd pairwise = cached.correlationMatrix(columns);
+            assert(pairwise.isApprox(fresh.correlationMatrix(columns), 1e-12));
+
+            const uint64_t revision = ds->revision();
+            if (step % 2 == 0) {
+                ds->append(batch(3000));
+            } else {
+                Dataset::Row row{{"A", 1.5}, {"B", 3}, {"C", std::nullopt}};
+                ds->addRow(row);
+                ds->append(batch(2999));
+                ++produced;
+            }
+            assert(ds->revision() == revision);
+        }
+        assert(ds->size() > 2 * size_t{65536});
+
+        // Against a two-pass computation over all the values
+        std::vector<double> a = ds->getColumn<double>("A");
+        double m = std::accumulate(a.begin(), a.end(), 0.0) / a.size();
+        double v = 0.0;
+        for (double x : a) v += (x - m) * (x - m);
+        assert(approx_equal(cached.mean<double>("A"), m, 1e-10));
+        assert(approx_equal(cached.variance<double>("A"), v / a.size(), 1e-9));
+
+        // Replacing the contents invalidates the cache
+        const uint64_t revision = ds->revision();
+        *ds = batch(1000);
+        assert(ds->revision() != revision && ds->size() == 1000);
+        assert(cached.mean<double>("A") == StatisticalAnalyzer(ds).mean<double>("A"));
+        Dataset copy = *ds;
+        assert(copy.revision() != ds->revision());
+
+        // Shared buffers stay valid and unchanged after the column is appended to
+        auto owner = ds->shareColumn("A");
+        ColumnView<double> view = ds->getColumnView<double>("A");
+        const std::vector<double> before(view.begin(), view.end());
+        ds->append(batch(5000));
+        assert(std::equal(before.begin(), before.end(), view.begin()) && view.size() == 1000);
+        assert(ds->getColumnView<double>("A").size() == 6000 && ds->getColumn<double>("A")[999] == before[999]);
+        *ds = Dataset();
+        assert(view[999] == before[999]);
+    }
+
+    void testBatchAppend() {
+        // Reference built row by row
+        Dataset reference;
+        std::vector<std::vector<OptionalDataValue>> rows;
+        for (int i = 0; i < 1000; ++i) {
+            rows.push_back({std::nullopt, i, std::nullopt});
+            if (i % 7 != 3) rows.back()[2] = 0.25 * i;
+            if (i % 11 != 0) rows.back()[0] = std::string(i % 2 ? "odd" : "even");
+            reference.addRow({{"Label", rows.back()[0]}, {"Id", i}, {"Score", rows.back()[2]}});
+        }
+        auto sameRows = [&reference](const Dataset& ds) {
+            assert(ds.size() == reference.size());
+            for (size_t i = 0; i < ds.size(); ++i) {
+                assert(ds.row(i) == reference.row(i));
+            }
+        };
+
+        // Positional rows, with the schema checked once per call
+        Dataset positional;
+        positional.addRows({"Label", "Id", "Score"}, {rows.begin(), rows.begin() + 437});
+        positional.addRows({"Label", "Id", "Score"}, {rows.begin() + 437, rows.end()});
+        sameRows(positional);
+        assert(positional.column("Id").type() == ColumnType::Int);
+        bool threw = false;
+        try {
+            positional.addRows({"Label", "Id"}, {{std::string("x"), 1}});
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && positional.size() == 1000);
+        threw = false;
+        try {
+            positional.addRows({"Label", "Id", "Score"}, {{std::string("x"), 1, 2.0}, {1, 2.0}});
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && positional.size() == 1000);
+        threw = false;
+        try {
+            Dataset duplicated;
+            duplicated.addRows({"A", "A"}, {});
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+
+        // Column-oriented batches of arrays and validity bitmaps, cut at unaligned rows
+        Dataset batched;
+        const uint64_t revision = batched.revision();
+        for (size_t begin : {size_t{0}, size_t{100}, size_t{163}, size_t{700}}) {
+            size_t end = begin == 700 ? 1000 : begin == 0 ? 100 : begin == 100 ? 163 : 700;
+            std::vector<int32_t> ids;
+            std::vector<double> scores;
+            std::vector<std::string> labels;
+            std::vector<uint64_t> scoreValid((end - begin + 63) / 64), labelValid((end - begin + 63) / 64);
+            for (size_t i = begin; i < end; ++i) {
+                ids.push_back(static_cast<int32_t>(i));
+                scores.push_back(i % 7 == 3 ? -1.0 : 0.25 * i);
+                labels.push_back(i % 2 ? "odd" : "even");
+                if (i % 7 != 3) scoreValid[(i - begin) / 64] |= uint64_t{1} << ((i - begin) % 64);
+                if (i % 11 != 0) labelValid[(i - begin) / 64] |= uint64_t{1} << ((i - begin) % 64);
+            }
+            Column id, score, label;
+            id.appendValues(ids.data(), ids.size());
+            score.appendValues(scores.data(), scores.size(), scoreValid.data());
+            label.appendValues(labels.data(), labels.size(), labelValid.data());
+            Dataset::ColumnBatch batch;
+            batch.emplace_back("Score", std::move(score));
+            batch.emplace_back("Label", std::move(label));
+            batch.emplace_back("Id", std::move(id));
+            batched.appendBatch(std::move(batch));
+        }
+        sameRows(batched);
+        assert(batched.revision() == revision);
+        assert(batched.column("Score").nullCount() == reference.column("Score").nullCount());
+        assert(std::isnan(batched.getColumnView<double>("Score")[3]));
+
+        threw = false;
+        try {
+            Dataset::ColumnBatch missing;
+            missing.emplace_back("Id", Column());
+            missing.back().second.appendInt(1);
+            batched.appendBatch(std::move(missing));
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && batched.size() == 1000);
+
+        // Ints appended to a Double column are converted, at an unaligned offset
+        Column mixed;
+        const std::vector<double> head = {0.5, 1.5, 2.5};
+        const std::vector<int32_t> tail(130, 4);
+        std::vector<uint64_t> tailValid = {~uint64_t{0}, ~uint64_t{0} ^ 2, 3};
+        mixed.appendValues(head.data(), head.size());
+        mixed.appendValues(tail.data(), tail.size(), tailValid.data());
+        assert(mixed.type() == ColumnType::Double && mixed.size() == 133 && mixed.nullCount() == 1);
+        assert(mixed.at(3) == OptionalDataValue(4.0) && !mixed.at(3 + 65) && mixed.at(132) == OptionalDataValue(4.0));
+        assert(std::isnan(mixed.view<double>()[3 + 65]));
+    }
+
+    void testHistogram() {
+        namespace K = ScientificToolbox::Statistics::Kernels;
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const double inf = std::numeric_limits<double>::infinity();
+
+        // Bin edges, out-of-range values and NaNs
+        Histogram linear = Histogram::linear(0.0, 100.0, 10);
+        for (int i = 0; i < 100; ++i) linear.add(static_cast<double>(i));
+        const std::vector<double> extra = {100.0, 100.5, -1.0, nan, inf, -inf, 0.0, 9.999};
+        linear.add(extra.data(), extra.size());
+        assert(linear.bins() == 10 && linear.edges().size() == 11 && linear.edges()[3] == 30.0);
+        assert(linear.counts()[0] == 12 && linear.counts()[9] == 11);
+        assert(linear.underflow() == 2 && linear.overflow() == 2 && linear.nanCount() == 1);
+        assert(linear.total() == 103);
+
+        Histogram logarithmic = Histogram::logarithmic(1.0, 1000.0, 3);
+        const std::vector<double> sizes = {1.0, 5.0, 50.0, 999.0, 1000.0, 0.0, -3.0, 2000.0};
+        logarithmic.add(sizes.data(), sizes.size());
+        assert(approx_equal(logarithmic.edges()[1], 10.0, 1e-9) && approx_equal(logarithmic.edges()[2], 100.0, 1e-9));
+        assert((logarithmic.counts() == std::vector<uint64_t>{2, 1, 2}));
+        assert(logarithmic.underflow() == 2 && logarithmic.overflow() == 1);
+
+        Histogram edges = Histogram::fromEdges({0.0, 1.0, 5.0, 10.0});
+        const std::vector<double> points = {0.0, 0.99, 1.0, 4.0, 5.0, 10.0, 10.1, -0.1, nan};
+        edges.add(points.data(), points.size());
+        assert((edges.counts() == std::vector<uint64_t>{2, 2, 2}));
+        assert(edges.underflow() == 1 && edges.overflow() == 1 && edges.nanCount() == 1);
+
+        bool threw = false;
+        try {
+            linear.merge(Histogram::linear(0.0, 100.0, 11));
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        threw = false;
+        try {
+            Histogram::fromEdges({0.0, 2.0, 2.0});
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        // Every instruction set maps values to the same slots
+        std::mt19937 gen(31);
+        std::uniform_real_distribution<double> wide(-20.0, 120.0);
+        std::vector<double> x(1003);
+        for (auto& v : x) v = wide(gen);
+        x[1] = nan;
+        x[2] = 0.0;
+        x[3] = 100.0;
+        x[4] = inf;
+        x[5] = -inf;
+        x[6] = 50.0;
+        std::vector<uint32_t> reference(x.size()), slots(x.size());
+        const K::Isa original = K::activeIsa();
+        K::setIsa(K::Isa::Scalar);
+        K::binIndices(x.data(), x.size(), 0.0, 100.0, 7, reference.data());
+        assert(reference[1] == 9 && reference[2] == 1 && reference[3] == 7 && reference[4] == 8 && reference[5] == 0);
+        for (K::Isa isa : {K::Isa::AVX2, K::Isa::AVX512}) {
+            if (!K::isSupported(isa)) continue;
+            K::setIsa(isa);
+            K::binIndices(x.data(), x.size(), 0.0, 100.0, 7, slots.data());
+            assert(slots == reference);
+        }
+        K::setIsa(original);
+
+        // Columns: threads, nulls, Int columns, filtered rows and fitted bins
+        auto ds = std::make_shared<Dataset>();
+        std::lognormal_distribution<double> latency(1.0, 1.2);
+        std::vector<double> valid;
+        Column ms, bucket;
+        for (int i = 0; i < 200000; ++i) {
+            if (i % 13 == 0) {
+                ms.appendNull();
+            } else {
+                valid.push_back(latency(gen));
+                ms.appendDouble(valid.back());
+            }
+            bucket.appendInt(i % 50);
+        }
+        ds->addColumn("Latency", std::move(ms));
+        ds->addColumn("Bucket", std::move(bucket));
+        StatisticalAnalyzer serial(ds), parallel(ds, 4);
+
+        Histogram fitted = parallel.histogram("Latency", 64, Binning::Log);
+        assert(fitted.scale() == Histogram::Scale::Log && fitted.total() == valid.size());
+        assert(fitted.underflow() == 0 && fitted.overflow() == 0 && fitted.nanCount() == 0);
+        assert(fitted.counts() == serial.histogram("Latency", 64, Binning::Log).counts());
+        assert(fitted.edges().front() == *std::min_element(valid.begin(), valid.end()));
+        double p99 = fitted.quantile(0.99);
+        double exact = serial.quantile<double>("Latency", 0.99);
+        assert(std::abs(p99 - exact) < exact * (std::pow(fitted.edges()[1] / fitted.edges()[0], 1.0) - 1.0));
+
+        Histogram fixed = parallel.histogram("Bucket", Histogram::linear(0.0, 50.0, 5));
+        assert((fixed.counts() == std::vector<uint64_t>(5, 40000)));
+        Histogram twice = parallel.histogram("Bucket", fixed);
+        assert(twice.total() == 400000);
+
+        Histogram quantiles = parallel.histogram("Latency", 10, Binning::Quantile);
+        assert(quantiles.bins() == 10 && quantiles.total() == valid.size());
+        for (uint64_t count : quantiles.counts()) {
+            assert(std::abs(static_cast<double>(count) - valid.size() / 10.0) < 0.03 * valid.size());
+        }
+
+        StatisticalAnalyzer low = parallel.where(Filter::less("Bucket", 10));
+        Histogram filtered = low.histogram("Bucket", Histogram::linear(0.0, 50.0, 5));
+        assert(filtered.total() == 40000 && filtered.counts()[0] == 40000);
+        assert(parallel.histogram("Bucket", 7).total() == 200000);
+
+        // Constant columns whose magnitude 0.5 cannot widen
+        for (double value : {1e17, -1e17, std::numeric_limits<double>::max()}) {
+            auto constant = std::make_shared<Dataset>();
+            Column c;
+            for (int i = 0; i < 100; ++i) c.appendDouble(value);
+            constant->addColumn("C", std::move(c));
+            StatisticalAnalyzer flat(constant);
+            for (Binning binning : {Binning::Linear, Binning::Quantile, Binning::Log}) {
+                if (binning == Binning::Log && value < 0) continue;
+                Histogram h = flat.histogram("C", 4, binning);
+                assert(h.total() == 100 && h.edges().front() < h.edges().back());
+                assert(h.edges().front() <= value && value <= h.edges().back());
+            }
+        }
+    }
+
+    void testCardinalitySketch() {
+        // Small cardinalities are exact; numbers hash by value
+        CardinalitySketch small;
+        for (int i = 0; i < 1000; ++i) {
+            small.add(static_cast<double>(i % 500));
+        }
+        small.add(-0.0);
+        small.add(std::numeric_limits<double>::quiet_NaN());
+        small.add(-std::numeric_limits<double>::quiet_NaN());
+        std::array<int32_t, 3> ints = {1, 2, 700};
+        small.add(ints.data(), ints.size());
+        assert(small.isExact() && small.estimate() == 502);
+        small.add(std::string_view());
+        small.add(std::string_view(""));
+        assert(small.estimate() == 503 && CardinalitySketch::hash(std::string_view()) != CardinalitySketch::hash("12345678"));
+        CardinalitySketch smallCopy = CardinalitySketch::deserialize(small.serialize());
+        assert(smallCopy.isExact() && smallCopy.estimate() == 503 && smallCopy.serialize() == small.serialize());
+
+        // Large cardinalities: overlapping halves merge into the union
+        CardinalitySketch left, right;
+        for (int i = 0; i < 200000; ++i) {
+            const std::string id = "user-" + std::to_string(i);
+            if (i < 150000) left.add(id);
+            if (i >= 50000) right.add(id);
+        }
+        assert(!left.isExact());
+        assert(std::abs(static_cast<double>(left.estimate()) - 150000.0) < 3 * left.standardError() * 150000.0);
+        left.merge(right);
+        assert(std::abs(static_cast<double>(left.estimate()) - 200000.0) < 3 * left.standardError() * 200000.0);
+        CardinalitySketch copy = CardinalitySketch::deserialize(left.serialize());
+        assert(copy.estimate() == left.estimate() && copy.serialize().size() == 6 + (size_t{1} << 14));
+        small.merge(copy);
+        assert(!small.isExact() && small.estimate() >= copy.estimate());
+
+        bool thrown = false;
+        try { CardinalitySketch(3); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { left.merge(CardinalitySketch(12)); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { CardinalitySketch::deserialize(left.serialize().substr(0, 100)); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown);
+
+        // Columns: threads, nulls, Int vs Double, strings, filtered rows
+        auto ds = std::make_shared<Dataset>();
+        Column id, value, name;
+        for (int i = 0; i < 300000; ++i) {
+            id.appendInt(i % 100000);
+            value.appendDouble(static_cast<double>(i % 100000));
+            if (i % 7 == 0) {
+                name.appendNull();
+            } else {
+                name.appendString("n" + std::to_string(i % 3000));
+            }
+        }
+        ds->addColumn("Id", std::move(id));
+        ds->addColumn("Value", std::move(value));
+        ds->addColumn("Name", std::move(name));
+        StatisticalAnalyzer serial(ds), parallel(ds, 4);
+
+        uint64_t distinct = parallel.approxDistinctCount("Id");
+        assert(distinct == serial.approxDistinctCount("Id") && distinct == parallel.approxDistinctCount("Value"));
+        assert(std::abs(static_cast<double>(distinct) - 100000.0) < 3000.0);
+        assert(parallel.approxDistinctCount("Name", 16) == 3000);
+        assert(parallel.cardinalitySketch("Name", 8).estimate() != 3000);
+        assert(parallel.where(Filter::less("Id", 1000)).approxDistinctCount("Value") == 1000);
+    }
+
+    void testRegression() {
+        std::mt19937 gen(11);
+        std::normal_distribution<double> dist(0.0, 1.0);
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+
+        // y = 3 + 2 x1 - 0.05 x2 + noise, x2 on another scale, nulls in x2 and y
+        auto makeBatch = [&](int begin, int end) {
+            Column x1, x2, y;
+            for (int i = begin; i < end; ++i) {
+                const double a = dist(gen), b = 100.0 * dist(gen);
+                x1.appendDouble(a);
+                if (i % 17 == 0) x2.appendNull(); else x2.appendDouble(b);
+                if (i % 23 == 0) y.appendNull(); else y.appendDouble(3.0 + 2.0 * a - 0.05 * b + 0.5 * dist(gen));
+            }
+            Dataset::ColumnBatch batch;
+            batch.emplace_back("X1", std::move(x1));
+            batch.emplace_back("X2", std::move(x2));
+            batch.emplace_back("Y", std::move(y));
+            return batch;
+        };
+        auto ds = std::make_shared<Dataset>();
+        ds->appendBatch(makeBatch(0, 140000));
+
+        // Reference: QR of the design matrix of the complete rows
+        auto reference = [&ds](bool intercept, double ridge) {
+            auto x1 = ds->column("X1").asDoubles(), x2 = ds->column("X2").asDoubles(), y = ds->column("Y").asDoubles();
+            std::vector<size_t> rows;
+            for (size_t i = 0; i < y.size(); ++i) {
+                if (!std::isnan(x2[i]) && !std::isnan(y[i])) rows.push_back(i);
+            }
+            const auto n = static_cast<Eigen::Index>(rows.size());
+            Eigen::MatrixXd x(n, intercept ? 3 : 2);
+            Eigen::VectorXd v(n);
+            for (Eigen::Index i = 0; i < n; ++i) {
+                x(i, 0) = x1[rows[i]];
+                x(i, 1) = x2[rows[i]];
+                if (intercept) x(i, 2) = 1.0;
+                v(i) = y[rows[i]];
+            }
+            if (ridge > 0.0) {
+                // Centered ridge system, the intercept left out of the penalty
+                Eigen::MatrixXd xc = x.leftCols(2).rowwise() - x.leftCols(2).colwise().mean();
+                Eigen::VectorXd yc = v.array() - v.mean();
+                Eigen::MatrixXd a = xc.transpose() * xc;
+                a.diagonal().array() += ridge;
+                return Eigen::VectorXd(a.ldlt().solve(xc.transpose() * yc));
+            }
+            Eigen::VectorXd b = x.householderQr().solve(v);
+            Eigen::VectorXd residuals = v - x * b;
+            const double sigma2 = residuals.squaredNorm() / static_cast<double>(n - x.cols());
+            Eigen::VectorXd se = (sigma2 * (x.transpose() * x).inverse()).diagonal().cwiseSqrt();
+            const double tss = intercept ? (v.array() - v.mean()).square().sum() : v.squaredNorm();
+            Eigen::VectorXd out(2 * x.cols() + 1);
+            out << b, se, 1.0 - residuals.squaredNorm() / tss;
+            return out;
+        };
+
+        StatisticalAnalyzer serial(ds), parallel(ds, 4);
+        RegressionResult fit = parallel.regression("Y", {"X1", "X2"});
+        Eigen::VectorXd expected = reference(true, 0.0);
+        assert(fit.predictors == std::vector<std::string>({"X1", "X2"}));
+        assert(std::abs(fit.coefficients(0) - 2.0) < 0.01 && std::abs(fit.coefficients(1) + 0.05) < 1e-4);
+        assert(approx_equal(fit.coefficients(0), expected(0), 1e-9) && approx_equal(fit.coefficients(1), expected(1), 1e-11));
+        assert(approx_equal(fit.intercept, expected(2), 1e-9));
+        assert(approx_equal(fit.standardErrors(0), expected(3), 1e-9) && approx_equal(fit.standardErrors(1), expected(4), 1e-11));
+        assert(approx_equal(fit.interceptStandardError, expected(5), 1e-9));
+        assert(approx_equal(fit.rSquared, expected(6), 1e-9) && fit.adjustedRSquared < fit.rSquared);
+        assert(std::abs(fit.residualStandardError - 0.5) < 0.01);
+        RegressionResult single = serial.regression("Y", {"X1", "X2"});
+        assert(single.coefficients == fit.coefficients && single.observations == fit.observations);
+
+        RegressionResult origin = parallel.regression("Y", {"X1", "X2"}, 0.0, false);
+        Eigen::VectorXd expectedOrigin = reference(false, 0.0);
+        assert(approx_equal(origin.coefficients(1), expectedOrigin(1), 1e-9) && origin.intercept == 0.0);
+        assert(approx_equal(origin.standardErrors(0), expectedOrigin(2), 1e-9) && std::isnan(origin.interceptStandardError));
+        assert(approx_equal(origin.rSquared, expectedOrigin(4), 1e-9));
+
+        RegressionResult ridge = parallel.regression("Y", {"X1", "X2"}, 1e6);
+        Eigen::VectorXd expectedRidge = reference(true, 1e6);
+        assert(approx_equal(ridge.coefficients(0), expectedRidge(0), 1e-9) && approx_equal(ridge.coefficients(1), expectedRidge(1), 1e-9));
+        assert(std::abs(ridge.coefficients(0)) < std::abs(fit.coefficients(0)) && ridge.rSquared < fit.rSquared);
+
+        // Streaming accumulators merged from batches give the same model
+        LinearRegression left(2), right(2);
+        auto x1 = ds->column("X1").asDoubles(), x2 = ds->column("X2").asDoubles(), y = ds->column("Y").asDoubles();
+        Eigen::MatrixXd block(1000, 3);
+        for (size_t r = 0; r < y.size(); r += 1000) {
+            for (Eigen::Index i = 0; i < 1000; ++i) {
+                block.row(i) << x1[r + i], x2[r + i], y[r + i];
+            }
+            (r % 3000 == 0 ? left : right).pushBlock(block);
+        }
+        right.push(Eigen::Vector2d(1.0, nan), 1.0);
+        left.merge(right);
+        RegressionResult streamed = left.fit();
+        assert(streamed.observations == fit.observations);
+        assert(approx_equal(streamed.coefficients(0), fit.coefficients(0), 1e-9) && approx_equal(streamed.intercept, fit.intercept, 1e-9));
+
+        // Appended rows are folded into the cached stripes
+        ds->appendBatch(makeBatch(140000, 210000));
+        RegressionResult grown = parallel.regression("Y", {"X1", "X2"});
+        RegressionResult fresh = StatisticalAnalyzer(ds).regression("Y", {"X1", "X2"});
+        assert(grown.observations > fit.observations && grown.coefficients == fresh.coefficients && grown.rSquared == fresh.rSquared);
+
+        // Collinear predictors, too few rows, bad arguments
+        ds->addColumn("Twice", [&ds] { Column c; for (double v : ds->column("X1").asDoubles()) c.appendDouble(2.0 * v); return c; }());
+        bool thrown = false;
+        try { parallel.regression("Y", {"X1", "Twice"}); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown);
+        assert(parallel.regression("Y", {"X1", "Twice"}, 1.0).coefficients.allFinite());
+        thrown = false;
+        try { parallel.regression("Y", {}); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { parallel.regression("Y", {"X1"}, -1.0); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { LinearRegression(1).fit(); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown);
+    }
+
+    void testStreamingAnalyzer() {
+        auto path = std::filesystem::temp_directory_path() / "stats_streaming.csv";
+        {
+            std::mt19937 gen(7);
+            std::normal_distribution<double> dist(3.0, 2.0);
+            std::ofstream out(path);
+            out << "X,Y,Label\n";
+            for (int i = 0; i < 1000; ++i) {
+                double x = dist(gen);
+                out << x << "," << 2.0 * x + dist(gen) << ",l" << i % 3 << "\n";
+            }
+        }
+        auto full = std::make_shared<Dataset>(Dataset::fromCSV(path.string()));
+        StatisticalAnalyzer reference(full);
+
+        StreamingAnalyzer stream;
+        stream.processCSV(path.string(), 64);
+        std::filesystem::remove(path);
+
+        assert(stream.rows() == 1000);
+        assert(stream.columns() == std::vector<std::string>({"X", "Y"}));
+        assert(approx_equal(stream.mean("X"), reference.mean<double>("X"), 1e-9));
+        assert(approx_equal(stream.variance("Y"), reference.variance<double>("Y"), 1e-9));
+        auto x = full->getColumn<double>("X");
+        assert(stream.min("X") == *std::min_element(x.begin(), x.end()));
+        assert(stream.max("X") == *std::max_element(x.begin(), x.end()));
+        assert(stream.correlationMatrix().isApprox(reference.correlationMatrix({"X", "Y"}), 1e-9));
+        assert(std::abs(stream.approxMedian("X") - reference.median<double>("X")) < 0.1);
+        assert(stream.approxDistinctCount("X") == reference.frequencyTable<double>("X").size());
+        RegressionResult streamed = stream.regression("Y", {"X"});
+        RegressionResult direct = reference.regression("Y", {"X"});
+        assert(approx_equal(streamed.coefficients(0), direct.coefficients(0), 1e-9));
+        assert(approx_equal(streamed.standardErrors(0), direct.standardErrors(0), 1e-9));
+        assert(approx_equal(streamed.rSquared, direct.rSquared, 1e-9));
+
+        // A stored NaN is a value, only empty cells are nulls
+        {
+            std::ofstream out(path);
+            out << "V,W\n1.5,1\nnan,2\n,3\n2.5,4\n";
+        }
+        auto withNaN = std::make_shared<Dataset>(Dataset::fromCSV(path.string()));
+        StreamingAnalyzer nanStream;
+        nanStream.processCSV(path.string(), 2);
+        std::filesystem::remove(path);
+        ColumnSummary summary = StatisticalAnalyzer(withNaN).describe({"V"})[0];
+        assert(summary.count == 3 && std::isnan(summary.mean));
+        assert(nanStream.count("V") == summary.count && std::isnan(nanStream.mean("V")));
+        assert(nanStream.count("W") == 4 && nanStream.approxDistinctCount("V") == 3);
+    }
+
 
     void TestNormal() {
 
@@ -101,9 +1523,33 @@ public:
             setUp();
             testMean();
             testMedian();
+            testQuantiles();
+            testQuantileSketch();
             testVariance();
             testStdDev();
+            testDescribe();
+            testKernels();
+            testParallelAnalyzer();
+            testFrequencyTable();
+            testGroupBy();
             testCorrelation();
+            testBlockedCorrelation();
+            testPairwiseCorrelation();
+            testRankCorrelation();
+            testColumnarStorage();
+            testStringPool();
+            testMappedImport();
+            testSnapshot();
+            testParallelImport();
+            testSchemaInference();
+            testProjectedImport();
+            testFilter();
+            testStatsCache();
+            testBatchAppend();
+            testHistogram();
+            testCardinalitySketch();
+            testRegression();
+            testStreamingAnalyzer();
             TestNormal();
         } catch (...) {
             return false;
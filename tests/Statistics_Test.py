@@ -312,6 +312,163 @@ class TestStatisticsModule(unittest.TestCase):
         self.assertAlmostEqual(corr_matrix[0, 1], np_corr[0, 1], delta=0.01,
             msg="C++ correlation should match NumPy correlation within tolerance.")
 
+    def test_numpy_interop(self):
+
+        # Columns built from arrays are borrowed, and handed back as arrays
+        # without copying, even after rows are appended.
+
+        values = np.random.normal(size=1000)
+        ints = np.arange(1000, dtype=np.int32)
+        labels = np.array(["a", None] * 500, dtype=object)
+        ds = stats.Dataset.fromNumpy({"x": values, "n": ints, "s": labels})
+        self.assertEqual(ds.size(), 1000)
+
+        x = ds.toNumpy("x")
+        self.assertTrue(np.shares_memory(x, values), "float64 columns should be borrowed.")
+        self.assertFalse(x.flags.writeable)
+        self.assertEqual(ds.toNumpy("n").dtype, np.int32)
+        self.assertEqual(list(ds.toNumpy("s")[:2]), ["a", None])
+        self.assertEqual(ds.getColumn("s"), ["a"] * 500)
+
+        analyzer = stats.StatisticalAnalyzer(ds)
+        self.assertAlmostEqual(analyzer.mean("x"), values.mean(), places=10)
+
+        ds.addRow({"x": 1.0, "n": 2, "s": "b"})
+        self.assertEqual(ds.size(), 1001)
+        self.assertTrue(np.array_equal(x, values), "Views should survive appends.")
+        self.assertEqual(ds.toNumpy("x")[-1], 1.0)
+
+        import pandas as pd
+        df = pd.DataFrame({"a": values, "b": np.arange(1000), "c": ["u", "v"] * 500})
+        from_df = stats.from_dataframe(df)
+        self.assertEqual(from_df.getColumnNames(), ["a", "b", "c"])
+        self.assertTrue(np.array_equal(from_df.toNumpy("b"), np.arange(1000)))
+        self.assertEqual(stats.StatisticalAnalyzer(from_df).mostFrequentStr("c", 1)[0][1], 500)
+
+    def test_batch_append(self):
+
+        # Batches of rows, as positional lists or as arrays per column,
+        # give the same dataset as rows added one by one.
+
+        by_row = stats.Dataset()
+        for i in range(300):
+            by_row.addRow({"x": i * 0.5, "n": i, "s": "even" if i % 2 == 0 else "odd"})
+
+        by_rows = stats.Dataset()
+        for begin in range(0, 300, 128):
+            by_rows.addRows(["s", "n", "x"],
+                            [["even" if i % 2 == 0 else "odd", i, i * 0.5]
+                             for i in range(begin, min(300, begin + 128))])
+
+        by_array = stats.Dataset()
+        for begin in range(0, 300, 100):
+            n = np.arange(begin, begin + 100, dtype=np.int32)
+            by_array.appendNumpy({"n": n, "x": n * 0.5,
+                                  "s": np.array(["even", "odd"] * 50, dtype=object)})
+
+        for ds in (by_rows, by_array):
+            self.assertEqual(ds.size(), 300)
+            for name in ("x", "n"):
+                self.assertTrue(np.array_equal(ds.toNumpy(name), by_row.toNumpy(name)))
+            self.assertEqual(ds.getColumn("s"), by_row.getColumn("s"))
+
+        with self.assertRaises(RuntimeError):
+            by_array.appendNumpy({"n": np.arange(3, dtype=np.int32)})
+        self.assertEqual(by_array.size(), 300)
+
+    def test_histogram(self):
+
+        # Fitted linear bins hold every value; quantiles interpolate within bins.
+
+        ds = stats.Dataset()
+        ds.appendNumpy({"x": np.arange(1, 1001, dtype=np.float64)})
+        analyzer = stats.StatisticalAnalyzer(ds)
+
+        h = analyzer.histogram("x", 10)
+        self.assertEqual(h.total(), 1000)
+        self.assertEqual(h.edges()[0], 1.0)
+        self.assertEqual(h.edges()[-1], 1000.0)
+        self.assertEqual(int(h.counts().sum()), 1000)
+        self.assertAlmostEqual(h.quantile(0.5), 500.0, delta=100.0)
+
+        log = analyzer.histogram("x", 30, stats.Binning.Log)
+        self.assertEqual(log.scale(), stats.Histogram.Scale.Log)
+        self.assertEqual(log.total(), 1000)
+
+        fixed = analyzer.histogram("x", stats.Histogram.fromEdges([0.0, 10.0, 100.0]))
+        self.assertEqual(list(fixed.counts()), [9, 91])
+        self.assertEqual(fixed.overflow(), 900)
+
+        manual = stats.Histogram.linear(0.0, 1.0, 4)
+        manual.add(np.array([0.1, 0.3, 0.6, 1.0, 2.0, -1.0, np.nan]))
+        self.assertEqual(list(manual.counts()), [1, 1, 1, 1])
+        self.assertEqual((manual.underflow(), manual.overflow(), manual.nanCount()), (1, 1, 1))
+
+        with self.assertRaises(ValueError):
+            manual.merge(stats.Histogram.linear(0.0, 2.0, 4))
+        with self.assertRaises(ValueError):
+            stats.Histogram.logarithmic(0.0, 1.0, 4)
+
+    def test_cardinality_sketch(self):
+
+        # Exact for small counts, mergeable and serializable once dense.
+
+        small = stats.CardinalitySketch()
+        for v in [1, 1.0, 2, "2", "a", "a"]:
+            small.add(v)
+        self.assertTrue(small.isExact())
+        self.assertEqual(small.estimate(), 4)
+
+        left, right = stats.CardinalitySketch(), stats.CardinalitySketch()
+        left.add(np.arange(0, 60000, dtype=np.int64))
+        right.add(np.arange(40000, 100000, dtype=np.float64))
+        left.merge(right)
+        self.assertFalse(left.isExact())
+        self.assertAlmostEqual(left.estimate(), 100000, delta=3 * left.standardError() * 100000)
+        copy = stats.CardinalitySketch.deserialize(left.serialize())
+        self.assertEqual(copy.estimate(), left.estimate())
+
+        with self.assertRaises(ValueError):
+            left.merge(stats.CardinalitySketch(10))
+
+        ds = stats.Dataset()
+        ds.appendNumpy({"id": np.arange(5000, dtype=np.int32) % 1000})
+        analyzer = stats.StatisticalAnalyzer(ds)
+        self.assertEqual(analyzer.approxDistinctCount("id"), 1000)
+        self.assertEqual(analyzer.cardinalitySketch("id", 12).precision(), 12)
+
+    def test_regression(self):
+
+        # OLS matches numpy's least squares; batches merged give the same fit.
+
+        rng = np.random.default_rng(3)
+        x = rng.normal(size=(5000, 2))
+        y = 1.5 + x @ np.array([2.0, -1.0]) + rng.normal(scale=0.1, size=5000)
+        ds = stats.Dataset()
+        ds.appendNumpy({"a": x[:, 0], "b": x[:, 1], "y": y})
+        analyzer = stats.StatisticalAnalyzer(ds)
+
+        fit = analyzer.regression("y", ["a", "b"])
+        design = np.column_stack([x, np.ones(5000)])
+        expected = np.linalg.lstsq(design, y, rcond=None)[0]
+        self.assertTrue(np.allclose(fit.coefficients, expected[:2]))
+        self.assertAlmostEqual(fit.intercept, expected[2])
+        self.assertEqual(fit.predictors, ["a", "b"])
+        self.assertGreater(fit.rSquared, 0.99)
+
+        model, other = stats.LinearRegression(2), stats.LinearRegression(2)
+        rows = np.column_stack([x, y])
+        model.pushBlock(rows[:2000])
+        other.pushBlock(rows[2000:])
+        model.merge(other)
+        self.assertEqual(model.count(), 5000)
+        self.assertTrue(np.allclose(model.fit().coefficients, fit.coefficients))
+
+        ridge = analyzer.regression("y", ["a", "b"], ridge=1e4)
+        self.assertLess(abs(ridge.coefficients[0]), abs(fit.coefficients[0]))
+        with self.assertRaises(ValueError):
+            analyzer.regression("y", [])
+
 
 if __name__ == "__main__":
     unittest.main()